@@ -3,6 +3,8 @@
 #define MAX_SIZE 2000
 
 Profiler profiler("demo-power");
+//the series is looked up once, not on every recursive call
+Profiler::SeriesId fastPowSeries = profiler.internSeries("fast_pow");
 
 /**
 * a function that slowly computes x to the power n
@@ -32,11 +34,11 @@ int fast_pow(int x, int n, int size){
 		y = fast_pow(x, n/2, size);
 		if(n % 2 == 0){
 			//count multiplications
-			profiler.countOperation("fast_pow", size);
+			profiler.countOperation(fastPowSeries, size);
 			return y * y;
 		}else{
 			//we can also count two multiplications at once
-			profiler.countOperation("fast_pow", size);
+			profiler.countOperation(fastPowSeries, size);
 			return y * y * x;
 		}
 	}
@@ -98,6 +98,9 @@ using namespace std;
 #define RANGE_MAX 50000
 
 #define DEBUG
+//keeps a journal of the finished jobs, so that an interrupted evaluation goes on from where it stopped
+//#define RESUME
+#define JOURNAL_FILE "journal-Direct-Sorting-Methods.txt"
 
 typedef void (*SortingAlgortithm)(int A[], size_t Size, Operation Ass, Operation Comp);
 
@@ -232,36 +235,45 @@ void BubbleSort(int A[], size_t Size, Operation Ass, Operation Comp)
     }
 }
 
-void EvaluateSortingAlgorithms()
+/**
+ * Measures the three algorithms on one input of the given size and order, the jobs of the
+ * sweep run on several threads, each with its own buffers
+ */
+void MeasureSortingAlgorithms(Profiler &profiler, Profiler::SweepJob &job, int order)
 {
-    static int data[MAX_SIZE], dataCopy[MAX_SIZE];
+    Profiler::SizeKey size = job.size;
+    int *data = job.buffer<int>(0), *dataCopy = job.buffer<int>(1);
+
+    Operation assIns = profiler.createOperation("assing_Insertion", size);
+    Operation assSel = profiler.createOperation("assing_Selection", size);
+    Operation assBub = profiler.createOperation("assing_Bubble", size);
+    Operation compIns = profiler.createOperation("comp_Insertion", size);
+    Operation compSel = profiler.createOperation("comp_Selection", size);
+    Operation compBub = profiler.createOperation("comp_Bubble", size);
+
+    FillRandomArray(data, size, RANGE_MIN, RANGE_MAX, false, order);
+    copy(data, data + size, dataCopy);
+
+    InsertionSort(data, size, assIns, compIns);
+
+    copy(dataCopy, dataCopy + size, data);
+    SelectionSort(data, size, assSel, compSel);
+
+    copy(dataCopy, dataCopy + size, data);
+    BubbleSort(data, size, assBub, compBub);
+}
 
+void EvaluateSortingAlgorithms()
+{
     //Best Case
     Profiler profiler("Direct-Sorting-Methods-Best-Case");
-    for (unsigned int size = MIN_SIZE; size <= MAX_SIZE; size += STEPS)
-    {
-        cout << "Evaluating best case for size: " << size << "\n";
-        Operation assIns = profiler.createOperation("assing_Insertion", size);
-        Operation assSel = profiler.createOperation("assing_Selection", size);
-        Operation assBub = profiler.createOperation("assing_Bubble", size);
-        Operation compIns = profiler.createOperation("comp_Insertion", size);
-        Operation compSel = profiler.createOperation("comp_Selection", size);
-        Operation compBub = profiler.createOperation("comp_Bubble", size);
-
-        FillRandomArray(data, size, RANGE_MIN, RANGE_MAX, false, 1);
-        copy(begin(data), end(data), begin(dataCopy));
-
-        cout << "\tInsertion\n";
-        InsertionSort(data, size, assIns, compIns);
-
-        copy(begin(dataCopy), end(dataCopy), begin(data));
-        cout << "\tSelection\n";
-        SelectionSort(data, size, assSel, compSel);
-
-        copy(begin(dataCopy), end(dataCopy), begin(data));
-        cout << "\tBubble\n";
-        BubbleSort(data, size, assBub, compBub);
-    }
+#ifdef RESUME
+    profiler.openJournal(JOURNAL_FILE);
+#endif // RESUME
+    cout << "Evaluating best case\n";
+    profiler.sweep(MIN_SIZE, MAX_SIZE, STEPS, 1, [&](Profiler::SweepJob &job) {
+        MeasureSortingAlgorithms(profiler, job, 1);
+    });
     profiler.addSeries("sum_Insertion", "assing_Insertion", "comp_Insertion");
     profiler.addSeries("sum_Selection", "assing_Selection", "comp_Selection");
     profiler.addSeries("sum_Bubble", "assing_Bubble", "comp_Bubble");
@@ -271,30 +283,10 @@ void EvaluateSortingAlgorithms()
 
     //Worst Case
     profiler.reset("Direct-Sorting-Methods-Worst-Case");
-    for (unsigned int size = MIN_SIZE; size <= MAX_SIZE; size += STEPS)
-    {
-        cout << "Evaluating worst case for size: " << size << "\n";
-        Operation assIns = profiler.createOperation("assing_Insertion", size);
-        Operation assSel = profiler.createOperation("assing_Selection", size);
-        Operation assBub = profiler.createOperation("assing_Bubble", size);
-        Operation compIns = profiler.createOperation("comp_Insertion", size);
-        Operation compSel = profiler.createOperation("comp_Selection", size);
-        Operation compBub = profiler.createOperation("comp_Bubble", size);
-
-        FillRandomArray(data, size, RANGE_MIN, RANGE_MAX, false, 2);
-        copy(begin(data), end(data), begin(dataCopy));
-
-        cout << "\tInsertion\n";
-        InsertionSort(data, size, assIns, compIns);
-
-        copy(begin(dataCopy), end(dataCopy), begin(data));
-        cout << "\tSelection\n";
-        SelectionSort(data, size, assSel, compSel);
-
-        copy(begin(dataCopy), end(dataCopy), begin(data));
-        cout << "\tBubble\n";
-        BubbleSort(data, size, assBub, compBub);
-    }
+    cout << "Evaluating worst case\n";
+    profiler.sweep(MIN_SIZE, MAX_SIZE, STEPS, 1, [&](Profiler::SweepJob &job) {
+        MeasureSortingAlgorithms(profiler, job, 2);
+    });
     profiler.addSeries("sum_Insertion", "assing_Insertion", "comp_Insertion");
     profiler.addSeries("sum_Selection", "assing_Selection", "comp_Selection");
     profiler.addSeries("sum_Bubble", "assing_Bubble", "comp_Bubble");
@@ -304,31 +296,10 @@ void EvaluateSortingAlgorithms()
 
     //Average Case
     profiler.reset("Direct-Sorting-Methods-Average-Case");
-    for (int m = 1; m <= NR_OF_MEASUREMENTS_AVERAGE_CASE; m++)
-        for (unsigned int size = MIN_SIZE; size <= MAX_SIZE; size += STEPS)
-        {
-            cout << "Evaluating average case for size: " << size << " - measurement: " << m << "\n";
-            Operation assIns = profiler.createOperation("assing_Insertion", size);
-            Operation assSel = profiler.createOperation("assing_Selection", size);
-            Operation assBub = profiler.createOperation("assing_Bubble", size);
-            Operation compIns = profiler.createOperation("comp_Insertion", size);
-            Operation compSel = profiler.createOperation("comp_Selection", size);
-            Operation compBub = profiler.createOperation("comp_Bubble", size);
-
-            FillRandomArray(data, size, RANGE_MIN, RANGE_MAX, false, 0);
-            copy(begin(data), end(data), begin(dataCopy));
-
-            cout << "\tInsertion\n";
-            InsertionSort(data, size, assIns, compIns);
-
-            copy(begin(dataCopy), end(dataCopy), begin(data));
-            cout << "\tSelection\n";
-            SelectionSort(data, size, assSel, compSel);
-
-            copy(begin(dataCopy), end(dataCopy), begin(data));
-            cout << "\tBubble\n";
-            BubbleSort(data, size, assBub, compBub);
-        }
+    cout << "Evaluating average case\n";
+    profiler.sweep(MIN_SIZE, MAX_SIZE, STEPS, NR_OF_MEASUREMENTS_AVERAGE_CASE, [&](Profiler::SweepJob &job) {
+        MeasureSortingAlgorithms(profiler, job, 0);
+    });
     profiler.divideValues("assing_Insertion", NR_OF_MEASUREMENTS_AVERAGE_CASE);
     profiler.divideValues("assing_Selection", NR_OF_MEASUREMENTS_AVERAGE_CASE);
     profiler.divideValues("assing_Bubble", NR_OF_MEASUREMENTS_AVERAGE_CASE);
@@ -343,6 +314,11 @@ void EvaluateSortingAlgorithms()
     profiler.createGroup("sum", "sum_Insertion", "sum_Selection", "sum_Bubble");
 
     profiler.showReport();
+#ifdef RESUME
+    //the evaluation is complete, the next one measures everything again
+    profiler.closeJournal();
+    remove(JOURNAL_FILE);
+#endif // RESUME
 }
 
 
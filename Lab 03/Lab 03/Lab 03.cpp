@@ -48,6 +48,8 @@
 #include <string>
 #include <ctime>
 
+//#define PROFILER_TRACE
+//#define PROFILER_CALL_SITES
 #include "Profiler.h"
 #include <cassert>
 
@@ -62,10 +64,12 @@ const int STEPS = 100;
 const int NR_OF_MEASUREMENTS_AVERAGE_CASE = 5;
 const int RANGE_MIN = 10;
 const int RANGE_MAX = 50000;
+const char *INPUT_SHAPES[] = { "random", "nearly_sorted", "few_unique", "organ_pipe", "sawtooth", "zipf", "all_equal", "runs", "gaussian" };
 
 #define DEMO
 
-void PrintArray(int A[], int Size, string Message = "")
+template <typename T>
+void PrintArray(T A[], int Size, string Message = "")
 {
     for (int i = 0; i < Size; i++)
     {
@@ -74,7 +78,8 @@ void PrintArray(int A[], int Size, string Message = "")
     cout << "- " << Message << "\n";
 }
 
-void PrintHeap(int A[], int HeapSize, string Message = "")
+template <typename T>
+void PrintHeap(T A[], int HeapSize, string Message = "")
 {
     int height = (int)log2((double)HeapSize) + 1;
     bool first = true;
@@ -114,8 +119,10 @@ inline int Right(int index)
     return index * 2 + 2;
 }
 
-void MaxHeapify(int A[], int HeapSize, int i, Operation Op)
+template <typename Counter, typename T>
+void MaxHeapify(T A[], int HeapSize, int i, Counter Op)
 {
+    DepthGuard depthGuard(Op);
     int largest = i;
     int left = Left(i);
     int right = Right(i);
@@ -139,7 +146,8 @@ void MaxHeapify(int A[], int HeapSize, int i, Operation Op)
     }
 }
 
-void BuildMaxHeapBottomUp(int A[], int ArraySize, Operation Op)
+template <typename Counter, typename T>
+void BuildMaxHeapBottomUp(T A[], int ArraySize, Counter Op)
 {
     int heapSize = ArraySize;
     for (int i = (heapSize - 1) / 2; i >= 0; i--)
@@ -148,13 +156,19 @@ void BuildMaxHeapBottomUp(int A[], int ArraySize, Operation Op)
     }
 }
 
-void HeapSort(int A[], int ArraySize, Operation Op)
+template <typename Counter, typename T>
+void HeapSort(T A[], int ArraySize, Counter Op)
 {
-    BuildMaxHeapBottomUp(A, ArraySize, Op);
+    TRACE_SPAN("HeapSort");
+    {
+        TRACE_SPAN("HeapSort/BuildMaxHeap");
+        BuildMaxHeapBottomUp(A, ArraySize, Op);
+    }
 #ifdef DEMO
     PrintHeap(A, ArraySize, "BuildMaxHeap was called");
 #endif // DEMO    
 
+    TRACE_SPAN("HeapSort/Extract");
     for (int i = ArraySize - 1; i >= 1; i--)
     {
         swap(A[0], A[i]);
@@ -170,9 +184,11 @@ void HeapSort(int A[], int ArraySize, Operation Op)
     }
 }
 
-void InsertionSort(int A[], int Size, Operation Ass, Operation Comp)
+template <typename Counter, typename T>
+void InsertionSort(T A[], int Size, Counter Ass, Counter Comp)
 {
-    int key, j;
+    T key;
+    int j;
     for (int i = 1; i < Size; i++)
     {
         key = A[i];
@@ -193,7 +209,8 @@ void InsertionSort(int A[], int Size, Operation Ass, Operation Comp)
     }
 }
 
-typedef int (*PartitionFunction)(int A[], int p, int r, Operation Op);
+template <typename Counter, typename T = int>
+using PartitionFunction = int (*)(T A[], int p, int r, Counter Op);
 
 inline int Size(int start, int end)
 {
@@ -201,9 +218,10 @@ inline int Size(int start, int end)
 }
 
 
-int Partition(int A[], int p, int r, Operation Op)
+template <typename Counter, typename T>
+int Partition(T A[], int p, int r, Counter Op)
 {
-    int x = A[r];
+    T x = A[r];
     Op.count();
     int i = p - 1;
     for (int j = p; j < r; j++)
@@ -221,7 +239,8 @@ int Partition(int A[], int p, int r, Operation Op)
     return i + 1;
 }
 
-int RandomizedPartition(int A[], int p, int r, Operation Op)
+template <typename Counter>
+int RandomizedPartition(int A[], int p, int r, Counter Op)
 {
     srand(time(0));
     int i = rand() % (r - p + 1) + p;
@@ -230,8 +249,10 @@ int RandomizedPartition(int A[], int p, int r, Operation Op)
     return Partition(A, p, r, Op);
 }
 
-int RandomizedSelect(int A[], int p, int r, int i, Operation Op)
+template <typename Counter>
+int RandomizedSelect(int A[], int p, int r, int i, Counter Op)
 {
+    DepthGuard depthGuard(Op);
     if (p == r)
         return A[p];
     int q = RandomizedPartition(A, p, r, Op);
@@ -248,23 +269,24 @@ int RandomizedSelect(int A[], int p, int r, int i, Operation Op)
     return RandomizedSelect(A, q + 1, r, i - k, Op);
 }
 
-int BestCasePartition(int A[], int p, int r, Operation Op)
+template <typename Counter>
+int BestCasePartition(int A[], int p, int r, Counter Op)
 {
-    Profiler profiler("dummy");
-    Operation dummy = profiler.createOperation("dummy", 0);
-
     int size = Size(p, r);
     int q = (size - 1) / 2 + p;
-    RandomizedSelect(A, p, r, q - p + 1, dummy);
+    RandomizedSelect(A, p, r, q - p + 1, NullOperation());
     swap(A[q], A[r]);
     return Partition(A, p, r, Op);
 }
 
 
-void QuickSort(int A[], int p, int r, Operation Op, PartitionFunction Partition)
+template <typename Counter, typename T>
+void QuickSort(T A[], int p, int r, Counter Op, PartitionFunction<Counter, T> Partition)
 {
     const int MinSizeToApplyDirectSort = 18;
     int size = Size(p, r);
+    TRACE_SPAN("QuickSort");
+    DepthGuard depthGuard(Op);
 
 #ifndef DEMO
     if (size <= MinSizeToApplyDirectSort)
@@ -272,7 +294,11 @@ void QuickSort(int A[], int p, int r, Operation Op, PartitionFunction Partition)
     else
     {
 #endif // !DEMO
-        int q = Partition(A, p, r, Op);
+        int q;
+        {
+            TRACE_SPAN("QuickSort/Partition");
+            q = Partition(A, p, r, Op);
+        }
 #ifdef DEMO
         PrintArray(A + p, size, "Partitioned for p = " + to_string(p) + ", r = " + to_string(r) + ", q = " + to_string(q));
 #endif // !DEMO
@@ -295,8 +321,7 @@ void Demo()
         arr6[] = { 2, 5, 1, 0, 4, 6, 3, 8, 7, 9, 10 };
     int size = 10;
 
-    Profiler profiler("Demo");
-    Operation op = profiler.createOperation("dummy", 0);
+    NullOperation op;
 
     cout << "\t\tHeapSort\n";
     PrintHeap(arr1, size, "Initial tree");
@@ -336,7 +361,8 @@ void Demo()
 
 void EvaluateSortingMethods()
 {
-    static int data[MAX_SIZE], dataCopy[MAX_SIZE], sorted[MAX_SIZE];
+    static int data[MAX_SIZE], dataCopy[MAX_SIZE];
+    SortVerifier verifier;
 
     //Best Case
     Profiler profiler("Sorting-Algorithms");
@@ -346,12 +372,11 @@ void EvaluateSortingMethods()
         Operation total = profiler.createOperation("total_QuickSort_best", size);
 
         FillRandomArray(data, size, RANGE_MIN, RANGE_MAX, false, RANDOM);
-        copy(begin(data), end(data), begin(sorted));
-        sort(sorted, sorted + size);
+        verifier.expect(data, size);
 
         cout << "\tQuickSort\n";
         QuickSort(data, 0, size - 1, total, BestCasePartition);
-        assert(memcmp(data, sorted, size * sizeof(int)) == 0);
+        assert(verifier.verify(data, size));
     }
 
     //Worst Case
@@ -361,48 +386,238 @@ void EvaluateSortingMethods()
         Operation totalQS = profiler.createOperation("total_QuickSort_worst", size);
 
         FillRandomArray(data, size, RANGE_MIN, RANGE_MAX, false, DESC);
-        copy(begin(data), end(data), begin(sorted));
-        sort(sorted, sorted + size);
+        verifier.expect(data, size);
 
         cout << "\tQuickSort\n";
         QuickSort(data, 0, size - 1, totalQS, Partition);
-        assert(memcmp(data, sorted, size * sizeof(int)) == 0);
+        assert(verifier.verify(data, size));
     }
 
     //Average Case
-    for (int m = 1; m <= NR_OF_MEASUREMENTS_AVERAGE_CASE; m++)
-        for (unsigned int size = MIN_SIZE; size <= MAX_SIZE; size += STEPS)
+    for (unsigned int size = MIN_SIZE; size <= MAX_SIZE; size += STEPS)
+        profiler.repeat(size, [&](int m)
         {
-            cout << "Evaluating average case for size: " << size << " - measurement: " << m << "\n";
+            cout << "Evaluating average case for size: " << size << " - measurement: " << m + 1 << "\n";
             Operation totalQS = profiler.createOperation("total_QuickSort_average", size);
             Operation totalRQS = profiler.createOperation("total_RandomizedQuickSort_average", size);
             Operation totalHeapSort = profiler.createOperation("total_HeapSort_average", size);
+            Timer timeQS = profiler.createTimer("time_QuickSort_average", size);
+            Timer timeRQS = profiler.createTimer("time_RandomizedQuickSort_average", size);
+            Timer timeHeapSort = profiler.createTimer("time_HeapSort_average", size);
 
             FillRandomArray(data, size, RANGE_MIN, RANGE_MAX, false, RANDOM);
             copy(begin(data), end(data), begin(dataCopy));
-            copy(begin(data), end(data), begin(sorted));
-            sort(sorted, sorted + size);
+            verifier.expect(data, size);
 
             cout << "\tQuickSort\n";
+            timeQS.start();
             QuickSort(data, 0, size - 1, totalQS, Partition);
-            assert(memcmp(data, sorted, size * sizeof(int)) == 0);
+            timeQS.stop();
+            assert(verifier.verify(data, size));
 
             cout << "\tRandomizedQuickSort\n";
             copy(begin(dataCopy), end(dataCopy), begin(data));
+            timeRQS.start();
             QuickSort(data, 0, size - 1, totalRQS, RandomizedPartition);
-            assert(memcmp(data, sorted, size * sizeof(int)) == 0);
+            timeRQS.stop();
+            assert(verifier.verify(data, size));
 
             cout << "\tHeapSort\n";
             copy(begin(dataCopy), end(dataCopy), begin(data));
+            timeHeapSort.start();
             HeapSort(data, size, totalHeapSort);
-            assert(memcmp(data, sorted, size * sizeof(int)) == 0);
-        }
-    profiler.divideValues("total_QuickSort_average", NR_OF_MEASUREMENTS_AVERAGE_CASE);
-    profiler.divideValues("total_RandomizedQuickSort_average", NR_OF_MEASUREMENTS_AVERAGE_CASE);
-    profiler.divideValues("total_HeapSort_average", NR_OF_MEASUREMENTS_AVERAGE_CASE);
-    profiler.createGroup("total_average", "total_QuickSort_average", "total_HeapSort_average", "total_RandomizedQuickSort_average");
+            timeHeapSort.stop();
+            assert(verifier.verify(data, size));
+
+            cout << "\tstd::sort\n";
+            copy(begin(dataCopy), end(dataCopy), begin(data));
+            {
+                CountedScope scope(profiler, "total_StdSort_average", size);
+                CountedSpan<int> span(data, size);
+                sort(span.begin(), span.end());
+            }
+            assert(verifier.verify(data, size));
+        }, NR_OF_MEASUREMENTS_AVERAGE_CASE, NR_OF_MEASUREMENTS_AVERAGE_CASE);
+    profiler.createGroup("total_average", "total_QuickSort_average", "total_HeapSort_average", "total_RandomizedQuickSort_average", "total_StdSort_average");
+    profiler.createGroup("time_average", "time_QuickSort_average", "time_HeapSort_average", "time_RandomizedQuickSort_average");
+    profiler.createGroup("total_time_HeapSort", "total_HeapSort_average", "time_HeapSort_average");
     profiler.createGroup("total_QuickSort", "total_QuickSort_average", "total_QuickSort_best", "total_RandomizedQuickSort_average");
 
+    profiler.showReport();
+#ifdef PROFILER_TRACE
+    ExportTrace("trace-Sorting-Algorithms.json");
+#endif // PROFILER_TRACE
+}
+
+void EvaluateInputShapes()
+{
+    static int data[MAX_SIZE], dataCopy[MAX_SIZE];
+    SortVerifier verifier;
+
+    Profiler profiler("Sorting-Algorithms-Input-Shapes");
+    for (const char *shape : INPUT_SHAPES)
+    {
+        string totalQS = string("total_QuickSort_") + shape;
+        string totalRQS = string("total_RandomizedQuickSort_") + shape;
+        string totalHS = string("total_HeapSort_") + shape;
+        for (unsigned int size = MIN_SIZE; size <= MAX_SIZE; size += STEPS)
+        {
+            cout << "Evaluating " << shape << " input of size: " << size << "\n";
+            Operation opQS = profiler.createOperation(totalQS.c_str(), size);
+            Operation opRQS = profiler.createOperation(totalRQS.c_str(), size);
+            Operation opHS = profiler.createOperation(totalHS.c_str(), size);
+
+            FillDistribution(data, size, shape, RANGE_MIN, RANGE_MAX);
+            copy(begin(data), end(data), begin(dataCopy));
+            verifier.expect(data, size);
+
+            QuickSort(data, 0, size - 1, opQS, Partition);
+            assert(verifier.verify(data, size));
+
+            copy(begin(dataCopy), end(dataCopy), begin(data));
+            QuickSort(data, 0, size - 1, opRQS, RandomizedPartition);
+            assert(verifier.verify(data, size));
+
+            copy(begin(dataCopy), end(dataCopy), begin(data));
+            HeapSort(data, size, opHS);
+            assert(verifier.verify(data, size));
+        }
+        profiler.createGroup((string("total_") + shape).c_str(), totalQS.c_str(), totalRQS.c_str(), totalHS.c_str());
+    }
+
+    profiler.showReport();
+}
+
+/**
+ * Runs HeapSort and QuickSort on Counted elements through a simulated cache hierarchy, to
+ * compare their locality: the heap jumps between parents and children, partitioning scans
+ */
+void EvaluateLocality()
+{
+    const int min_size = 10000;
+    const int max_size = 200000;
+    const int steps = 10000;
+
+    static int data[max_size], dataCopy[max_size];
+    SortVerifier verifier;
+
+    Profiler profiler("Sorting-Algorithms-Locality");
+    CacheSimulator cache;
+    for (int size = min_size; size <= max_size; size += steps)
+    {
+        cout << "Evaluating locality for size: " << size << "\n";
+        FillRandomArray(data, size, RANGE_MIN, RANGE_MAX, false, RANDOM);
+        copy(data, data + size, dataCopy);
+        verifier.expect(data, size);
+
+        cache.reset();
+        {
+            CountedScope scope(profiler, "HeapSort", size, &cache);
+            CountedSpan<int> span(data, size);
+            HeapSort(span.begin(), size, NullOperation());
+        }
+        assert(verifier.verify(data, size));
+
+        copy(dataCopy, dataCopy + size, data);
+        cache.reset();
+        {
+            CountedScope scope(profiler, "QuickSort", size, &cache);
+            CountedSpan<int> span(data, size);
+            QuickSort(span.begin(), 0, size - 1, NullOperation(), Partition);
+        }
+        assert(verifier.verify(data, size));
+    }
+    profiler.createGroup("l1_misses", "HeapSort_l1_misses", "QuickSort_l1_misses");
+    profiler.createGroup("l2_misses", "HeapSort_l2_misses", "QuickSort_l2_misses");
+    profiler.createGroup("llc_misses", "HeapSort_llc_misses", "QuickSort_llc_misses");
+    profiler.createGroup("total", "HeapSort", "QuickSort");
+
+    profiler.showReport();
+}
+
+/**
+ * Times HeapSort pinned to one core after warmup runs, once with the input left in the
+ * caches by the warmups and once with the caches flushed before the measured run
+ */
+void EvaluateHeapSortCaching()
+{
+    static int data[MAX_SIZE], dataCopy[MAX_SIZE];
+    const char *names[] = { "time_HeapSort_warm", "time_HeapSort_cold" };
+    SortVerifier verifier;
+
+    Profiler profiler("HeapSort-Warm-And-Cold-Cache");
+    for (int cold = 0; cold < 2; ++cold)
+    {
+        profiler.setNoiseControl(0, 3, cold == 1);
+        for (int size = MIN_SIZE; size <= MAX_SIZE; size += STEPS)
+        {
+            cout << "Evaluating HeapSort with " << (cold ? "cold" : "warm") << " caches for size: " << size << "\n";
+            FillRandomArray(dataCopy, size, RANGE_MIN, RANGE_MAX, false, RANDOM);
+            verifier.expect(dataCopy, size);
+            profiler.benchmark(size, [&]()
+            {
+                copy(dataCopy, dataCopy + size, data);
+            }, [&]()
+            {
+                Timer timer = profiler.createTimer(names[cold], size);
+                timer.start();
+                HeapSort(data, size, NullOperation());
+                timer.stop();
+            });
+            assert(verifier.verify(data, size));
+        }
+    }
+    profiler.addEnvironment("cold cache", "time_HeapSort_cold only");
+    profiler.createGroup("time_HeapSort", names[0], names[1]);
+
+    profiler.showReport();
+}
+
+/**
+ * Sorts DESC input of the given size with QuickSort, recording its recursion depth under name,
+ * with the depth histograms only if asked for, since they add up over every size of a sweep
+ */
+void MeasureRecursionDepth(Profiler& profiler, const string& name, int size, PartitionFunction<Operation> partition, bool histograms)
+{
+    static int data[MAX_SIZE];
+    SortVerifier verifier;
+
+    FillRandomArray(data, size, RANGE_MIN, RANGE_MAX, false, DESC);
+    verifier.expect(data, size);
+    {
+        DepthScope depth(profiler, name.c_str(), size, histograms);
+        QuickSort(data, 0, size - 1, profiler.createOperation(name.c_str(), size), partition);
+    }
+    assert(verifier.verify(data, size));
+}
+
+/**
+ * Compares the recursion of QuickSort on DESC input with the last element as pivot, which
+ * goes about as deep as the input is long, and with random pivots, which stay logarithmic
+ */
+void EvaluateRecursionDepth()
+{
+    const int histogram_size = 2000;
+    const string histogram = "_" + to_string(histogram_size);
+
+    Profiler profiler("Sorting-Algorithms-Recursion-Depth");
+    for (int size = MIN_SIZE; size <= MAX_SIZE; size += STEPS)
+    {
+        cout << "Evaluating recursion depth for size: " << size << "\n";
+        MeasureRecursionDepth(profiler, "QuickSort_DESC", size, Partition, false);
+        MeasureRecursionDepth(profiler, "RandomizedQuickSort_DESC", size, RandomizedPartition, false);
+    }
+    MeasureRecursionDepth(profiler, "QuickSort_DESC" + histogram, histogram_size, Partition, true);
+    MeasureRecursionDepth(profiler, "RandomizedQuickSort_DESC" + histogram, histogram_size, RandomizedPartition, true);
+
+    profiler.createGroup("max_depth", "QuickSort_DESC_max_depth", "RandomizedQuickSort_DESC_max_depth");
+    profiler.createGroup(("calls_at_depth" + histogram).c_str(), ("QuickSort_DESC" + histogram + "_calls_at_depth").c_str(),
+        ("RandomizedQuickSort_DESC" + histogram + "_calls_at_depth").c_str());
+    profiler.createGroup(("ops_at_depth" + histogram).c_str(), ("QuickSort_DESC" + histogram + "_ops_at_depth").c_str(),
+        ("RandomizedQuickSort_DESC" + histogram + "_ops_at_depth").c_str());
+    profiler.createGroup(("time_at_depth" + histogram).c_str(), ("QuickSort_DESC" + histogram + "_time_at_depth").c_str(),
+        ("RandomizedQuickSort_DESC" + histogram + "_time_at_depth").c_str());
+
     profiler.showReport();
 }
 
@@ -415,7 +630,8 @@ void FindDelta()
     const int range_min = 10;
     const int range_max = 50000;
 
-    static int data[max_size], dataCopy[max_size], sorted[max_size];
+    static int data[max_size], dataCopy[max_size];
+    SortVerifier verifier;
 
     //ASC
     Profiler profiler("Finding Delta");
@@ -429,22 +645,21 @@ void FindDelta()
 
         FillRandomArray(data, size, range_min, range_max, false, ASC);
         copy(begin(data), end(data), begin(dataCopy));
-        copy(begin(data), end(data), begin(sorted));
-        sort(sorted, sorted + size);
+        verifier.expect(data, size);
 
         cout << "\tQuickSort\n";
         QuickSort(data, 0, size - 1, totalQS, Partition);
-        assert(memcmp(data, sorted, size * sizeof(int)) == 0);
+        assert(verifier.verify(data, size));
 
         cout << "\tRandomizedQuickSort\n";
         copy(begin(dataCopy), end(dataCopy), begin(data));
         QuickSort(data, 0, size - 1, totalRQS, RandomizedPartition);
-        assert(memcmp(data, sorted, size * sizeof(int)) == 0);
+        assert(verifier.verify(data, size));
 
         cout << "\tInsertionSort\n";
         copy(begin(dataCopy), end(dataCopy), begin(data));
         InsertionSort(data, size, totalIS, totalIS);
-        assert(memcmp(data, sorted, size * sizeof(int)) == 0);
+        assert(verifier.verify(data, size));
     }
     profiler.createGroup("total_ASC", "total_QuickSort_ASC", "total_RandomizedQuickSort_ASC", "total_InsertionSort_ASC");
 
@@ -459,22 +674,21 @@ void FindDelta()
 
         FillRandomArray(data, size, range_min, range_max, false, DESC);
         copy(begin(data), end(data), begin(dataCopy));
-        copy(begin(data), end(data), begin(sorted));
-        sort(sorted, sorted + size);
+        verifier.expect(data, size);
 
         cout << "\tQuickSort\n";
         QuickSort(data, 0, size - 1, totalQS, Partition);
-        assert(memcmp(data, sorted, size * sizeof(int)) == 0);
+        assert(verifier.verify(data, size));
 
         cout << "\tRandomizedQuickSort\n";
         copy(begin(dataCopy), end(dataCopy), begin(data));
         QuickSort(data, 0, size - 1, totalRQS, RandomizedPartition);
-        assert(memcmp(data, sorted, size * sizeof(int)) == 0);
+        assert(verifier.verify(data, size));
 
         cout << "\tInsertionSort\n";
         copy(begin(dataCopy), end(dataCopy), begin(data));
         InsertionSort(data, size, totalIS, totalIS);
-        assert(memcmp(data, sorted, size * sizeof(int)) == 0);
+        assert(verifier.verify(data, size));
     }
     profiler.createGroup("total_DESC", "total_QuickSort_DESC", "total_RandomizedQuickSort_DESC", "total_InsertionSort_DESC");
 
@@ -490,22 +704,21 @@ void FindDelta()
 
             FillRandomArray(data, size, range_min, range_max, false, RANDOM);
             copy(begin(data), end(data), begin(dataCopy));
-            copy(begin(data), end(data), begin(sorted));
-            sort(sorted, sorted + size);
+            verifier.expect(data, size);
 
             cout << "\tQuickSort\n";
             QuickSort(data, 0, size - 1, totalQS, Partition);
-            assert(memcmp(data, sorted, size * sizeof(int)) == 0);
+            assert(verifier.verify(data, size));
 
             cout << "\tRandomizedQuickSort\n";
             copy(begin(dataCopy), end(dataCopy), begin(data));
             QuickSort(data, 0, size - 1, totalRQS, RandomizedPartition);
-            assert(memcmp(data, sorted, size * sizeof(int)) == 0);
+            assert(verifier.verify(data, size));
 
             cout << "\tInsertionSort\n";
             copy(begin(dataCopy), end(dataCopy), begin(data));
             InsertionSort(data, size, totalIS, totalIS);
-            assert(memcmp(data, sorted, size * sizeof(int)) == 0);
+            assert(verifier.verify(data, size));
         }
     profiler.divideValues("total_QuickSort_average", nr_of_measurements_average_case);
     profiler.divideValues("total_RandomizedQuickSort_average", nr_of_measurements_average_case);
@@ -515,13 +728,58 @@ void FindDelta()
     profiler.showReport();
         }
 
+/**
+ * Looks for the size below which InsertionSort does fewer operations than QuickSort on
+ * random input, letting the profiler choose the sizes, so they gather around the crossing
+ * instead of being spread evenly
+ */
+void FindDeltaAdaptive()
+{
+    const int max_size = 2000;
+    const double budget_seconds = 5;
+
+    static int data[max_size], dataCopy[max_size];
+    SortVerifier verifier;
+
+    Profiler profiler("Finding Delta Adaptively");
+    profiler.createGroup("total_average", "total_QuickSort_average", "total_InsertionSort_average");
+    int sizes = profiler.adaptiveSweep(2, max_size, budget_seconds, [&](int size)
+    {
+        cout << "Evaluating average case for size: " << size << "\n";
+        profiler.repeat(size, [&](int)
+        {
+            Operation totalQS = profiler.createOperation("total_QuickSort_average", size);
+            Operation totalIS = profiler.createOperation("total_InsertionSort_average", size);
+
+            FillRandomArray(data, size, RANGE_MIN, RANGE_MAX, false, RANDOM);
+            copy(data, data + size, dataCopy);
+            verifier.expect(data, size);
+
+            QuickSort(data, 0, size - 1, totalQS, Partition);
+            assert(verifier.verify(data, size));
+
+            copy(dataCopy, dataCopy + size, data);
+            InsertionSort(data, size, totalIS, totalIS);
+            assert(verifier.verify(data, size));
+        }, NR_OF_MEASUREMENTS_AVERAGE_CASE, NR_OF_MEASUREMENTS_AVERAGE_CASE);
+    }, "total_average");
+    cout << "Measured " << sizes << " sizes\n";
+
+    profiler.showReport();
+}
+
 int main()
 {
 #ifdef DEMO
     Demo();
     //FindDelta();
+    //FindDeltaAdaptive();
 #else
     EvaluateSortingMethods();
+    //EvaluateInputShapes();
+    //EvaluateLocality();
+    //EvaluateHeapSortCaching();
+    //EvaluateRecursionDepth();
 #endif // DEMO
     return 0;
 }
\ No newline at end of file
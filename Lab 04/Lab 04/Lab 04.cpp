@@ -40,11 +40,16 @@
  *      the running time is linear.
  *  When n is a fixed value (10000) and k is variable, n is a constant, thus the complexity of the algorithm is O(log k). This can be seen on the chart, the growth rate of the
  *      running time is logarithmic.
+ *  EvaluateMergeLocality runs the merge through a simulated cache: the list nodes are followed one by one, so when the nodes of a list are
+ *      scattered in memory about every node moved misses L1 and L2, while nodes allocated in order share their cache lines and
+ *      miss half as often. All the nodes fit in the last level, so both only take its compulsory misses there.
  */
 
 #include <iostream>
 #include <list>
 #include <vector>
+#include <algorithm>
+#include <random>
 #include "Profiler.h"
 #include <cassert>
 
@@ -321,6 +326,7 @@ list<int> MergeKSortedLists(vector<list<int>> Lists, Operation Op)
     {
         if (!Lists.at(i).empty())
         {
+            CountedAccess(&Lists.at(i).front(), sizeof(int));
             data.emplace_back(Lists.at(i).front(), i);
         }
     }
@@ -342,6 +348,10 @@ list<int> MergeKSortedLists(vector<list<int>> Lists, Operation Op)
         const Element& element = heap.Top();
         list<int>& l = Lists.at(element.list_index);
 
+        // the moved node is relinked after the tail of the result
+        CountedAccess(&l.front(), sizeof(int));
+        if (!result.empty())
+            CountedAccess(&result.back(), sizeof(int));
         result.splice(result.end(), l, l.begin());
 
         if (l.empty())
@@ -350,6 +360,7 @@ list<int> MergeKSortedLists(vector<list<int>> Lists, Operation Op)
         }
         else
         {
+            CountedAccess(&l.front(), sizeof(int));
             heap.ReplaceTop(Element(l.front(), element.list_index));
         }
     }
@@ -377,7 +388,7 @@ void Evaluate()
             for (int n = n_range_min; n <= n_range_max; n += n_increment)
             {
                 vector<list<int>> lists = GenerateKSortedLists(n, k);
-                Operation op = profiler.createOperation(("k_" + to_string(k)).c_str(), n);
+                Operation op = profiler.createOperation(profiler.gridSeries("merge", k, "n", "k"), n);
 
                 list<int> result = MergeKSortedLists(lists, op);
                 assert(result.size() == n);
@@ -390,25 +401,82 @@ void Evaluate()
         for (int k = k_range_min; k <= k_range_max; k += k_increment)
         {
             vector<list<int>> lists = GenerateKSortedLists(k_fixed_n, k);
-            Operation op = profiler.createOperation(("n_" + to_string(k_fixed_n)).c_str(), k);
+            Operation op = profiler.createOperation(profiler.gridSeries("merge_fixed_n", k_fixed_n, "k", "n"), k);
 
             list<int> result = MergeKSortedLists(lists, op);
         }
     }
 
-    profiler.divideValues(("k_" + to_string(k_vector.at(0))).c_str(), nr_of_measurements);
-    profiler.divideValues(("k_" + to_string(k_vector.at(1))).c_str(), nr_of_measurements);
-    profiler.divideValues(("k_" + to_string(k_vector.at(2))).c_str(), nr_of_measurements);
-    profiler.divideValues(("n_" + to_string(k_fixed_n)).c_str(), nr_of_measurements);
-
-    profiler.createGroup("merge_for_fixed_k",
-        ("k_" + to_string(k_vector.at(0))).c_str(),
-        ("k_" + to_string(k_vector.at(1))).c_str(),
-        ("k_" + to_string(k_vector.at(2))).c_str()
-    );
-    profiler.createGroup("merge_for_fixed_n",
-        ("n_" + to_string(k_fixed_n)).c_str()
-    );
+    profiler.divideGrid("merge", nr_of_measurements);
+    profiler.divideGrid("merge_fixed_n", nr_of_measurements);
+
+    profiler.showReport();
+}
+
+/**
+ * Builds the same lists as GenerateKSortedLists, but with their nodes taken in random order
+ * from one pool, so that the nodes of a list are scattered in memory
+ */
+vector<list<int>> ScatterLists(const vector<list<int>>& Lists, mt19937& rng)
+{
+    size_t n = 0;
+    for (const list<int>& l : Lists)
+        n += l.size();
+
+    list<int> pool(n);
+    vector<list<int>::iterator> nodes;
+    for (list<int>::iterator it = pool.begin(); it != pool.end(); it++)
+        nodes.push_back(it);
+    shuffle(nodes.begin(), nodes.end(), rng);
+
+    vector<list<int>> result(Lists.size());
+    size_t next_node = 0;
+    for (size_t i = 0; i < Lists.size(); i++)
+    {
+        for (int key : Lists.at(i))
+        {
+            *nodes.at(next_node) = key;
+            result.at(i).splice(result.at(i).end(), pool, nodes.at(next_node++));
+        }
+    }
+    return result;
+}
+
+/**
+ * Merges k lists through a simulated cache hierarchy, once with the nodes of every list
+ * allocated one after the other and once with them scattered, to see what the pointer
+ * chasing of a list costs when the nodes are not in the order they are visited
+ */
+void EvaluateMergeLocality()
+{
+    const int k = 100;
+    const int n_range_min = 10000;
+    const int n_range_max = 200000;
+    const int n_increment = 10000;
+    const char *names[] = { "merge_in_order", "merge_scattered" };
+    mt19937 rng(42);
+
+    Profiler profiler("Merge-K-Sorted-Lists-Locality");
+    CacheSimulator cache;
+    for (int n = n_range_min; n <= n_range_max; n += n_increment)
+    {
+        cout << "Evaluating locality for n: " << n << "\n";
+        vector<list<int>> lists = GenerateKSortedLists(n, k);
+        vector<list<int>> scattered = ScatterLists(lists, rng);
+
+        for (int i = 0; i < 2; i++)
+        {
+            cache.reset();
+            CountedScope scope(profiler, names[i], n, &cache);
+            // the lists are moved into the merge, a copy would allocate the nodes again in order
+            list<int> result = MergeKSortedLists(move(i == 0 ? lists : scattered), profiler.createOperation(names[i], n));
+            assert(result.size() == (size_t)n);
+        }
+    }
+    profiler.createGroup("l1_misses", "merge_in_order_l1_misses", "merge_scattered_l1_misses");
+    profiler.createGroup("l2_misses", "merge_in_order_l2_misses", "merge_scattered_l2_misses");
+    profiler.createGroup("llc_misses", "merge_in_order_llc_misses", "merge_scattered_llc_misses");
+
     profiler.showReport();
 }
 
@@ -433,6 +501,7 @@ int main()
     Demo();
 #else
     Evaluate();
+    //EvaluateMergeLocality();
 #endif // DEMO
 
     return 0;
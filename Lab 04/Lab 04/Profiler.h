@@ -11,19 +11,59 @@
 #ifdef _MSC_VER
 #   include <Windows.h>
 #   include <Shellapi.h>
+#   include <io.h>
+#else
+#   include <unistd.h>
+#   include <sys/utsname.h>
+#endif
+
+#ifdef __linux__
+#   include <sched.h>
+#   include <linux/perf_event.h>
+#   include <sys/syscall.h>
+#   include <sys/ioctl.h>
+#endif
+
+#ifdef __GLIBC__
+#   include <malloc.h>
 #endif
 
 #include <stdio.h>
+#include <stdarg.h>
 #include <string.h>
 #include <stdlib.h>
 #include <time.h>
+#include <math.h>
 
 #include <typeinfo>
+#include <cstddef>
 #include <map>
 #include <vector>
 #include <algorithm>
 #include <functional>
 #include <string>
+#include <list>
+#include <memory>
+#include <new>
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <exception>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#   define PROFILER_HAS_RDTSC 1
+#   ifdef _MSC_VER
+#       include <intrin.h>
+#   else
+#       include <x86intrin.h>
+#   endif
+#endif
+
+#if defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   define PROFILER_HAS_SSE2 1
+#   include <emmintrin.h>
+#endif
 
 namespace HtmlGen{
 const char htmlFirst[] = {
@@ -10958,141 +10998,971 @@ const char htmlFirst[] = {
 0x0a, 0x09, 0x22, 0x6f, 0x70, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x22, 0x3a, 0x20, 0x22, 0x4f, 0x70, 
 0x65, 0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 
 0x22, 0x2c, 0x0a, 0x09, 0x22, 0x74, 0x69, 0x6d, 0x65, 0x73, 0x22, 0x3a, 0x20, 0x22, 0x45, 0x78, 
-0x65, 0x63, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x73, 0x22, 0x0a, 0x7d, 
-0x0a, 0x0a, 0x76, 0x61, 0x72, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x3d, 0x20
+0x65, 0x63, 0x75, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x73, 0x22, 0x2c, 0x0a, 
+0x09, 0x22, 0x68, 0x61, 0x72, 0x64, 0x77, 0x61, 0x72, 0x65, 0x22, 0x3a, 0x20, 0x22, 0x48, 0x61, 
+0x72, 0x64, 0x77, 0x61, 0x72, 0x65, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x65, 0x72, 0x73, 0x22, 
+0x2c, 0x0a, 0x09, 0x22, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x22, 0x3a, 0x20, 0x22, 0x4d, 0x65, 
+0x6d, 0x6f, 0x72, 0x79, 0x20, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 
+0x22, 0x0a, 0x7d, 0x0a, 0x0a, 0x76, 0x61, 0x72, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x3d, 0x20
 };
 
 const char htmlLast[] = {
 0x0a, 0x09, 0x76, 0x61, 0x72, 0x20, 0x62, 0x6f, 0x64, 0x79, 0x20, 0x3d, 0x20, 0x24, 0x28, 0x27, 
-0x62, 0x6f, 0x64, 0x79, 0x27, 0x29, 0x3b, 0x0a, 0x09, 0x0a, 0x09, 0x66, 0x6f, 0x72, 0x28, 0x76, 
-0x61, 0x72, 0x20, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x69, 0x6e, 0x20, 0x53, 0x45, 
-0x43, 0x54, 0x49, 0x4f, 0x4e, 0x53, 0x29, 0x7b, 0x0a, 0x09, 0x09, 0x69, 0x66, 0x28, 0x21, 0x69, 
-0x73, 0x45, 0x6d, 0x70, 0x74, 0x79, 0x28, 0x64, 0x61, 0x74, 0x61, 0x5b, 0x73, 0x65, 0x63, 0x74, 
-0x69, 0x6f, 0x6e, 0x5d, 0x29, 0x29, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x62, 0x6f, 0x64, 0x79, 0x2e, 
-0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x28, 0x22, 0x3c, 0x68, 0x31, 0x3e, 0x22, 0x20, 0x2b, 0x20, 
-0x53, 0x45, 0x43, 0x54, 0x49, 0x4f, 0x4e, 0x53, 0x5b, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 
-0x5d, 0x20, 0x2b, 0x20, 0x22, 0x3c, 0x2f, 0x68, 0x31, 0x3e, 0x5c, 0x6e, 0x22, 0x29, 0x3b, 0x0a, 
-0x09, 0x09, 0x09, 0x2f, 0x2f, 0x66, 0x69, 0x72, 0x73, 0x74, 0x2c, 0x20, 0x73, 0x68, 0x6f, 0x77, 
-0x20, 0x74, 0x68, 0x65, 0x20, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x73, 0x0a, 0x09, 0x09, 0x09, 0x76, 
-0x61, 0x72, 0x20, 0x75, 0x73, 0x65, 0x64, 0x20, 0x3d, 0x20, 0x7b, 0x7d, 0x3b, 0x0a, 0x09, 0x09, 
-0x09, 0x66, 0x6f, 0x72, 0x28, 0x76, 0x61, 0x72, 0x20, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x20, 0x69, 
-0x6e, 0x20, 0x64, 0x61, 0x74, 0x61, 0x5b, 0x22, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x73, 0x22, 0x5d, 
-0x29, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x76, 0x61, 0x72, 0x20, 0x70, 0x72, 0x65, 0x73, 0x65, 
-0x6e, 0x74, 0x20, 0x3d, 0x20, 0x74, 0x72, 0x75, 0x65, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x66, 
-0x6f, 0x72, 0x28, 0x76, 0x61, 0x72, 0x20, 0x69, 0x3d, 0x30, 0x3b, 0x20, 0x69, 0x20, 0x3c, 0x20, 
-0x64, 0x61, 0x74, 0x61, 0x5b, 0x22, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x73, 0x22, 0x5d, 0x5b, 0x67, 
-0x72, 0x6f, 0x75, 0x70, 0x5d, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3b, 0x20, 0x2b, 0x2b, 
-0x69, 0x29, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x69, 0x66, 0x28, 0x21, 0x28, 0x64, 0x61, 
+0x62, 0x6f, 0x64, 0x79, 0x27, 0x29, 0x3b, 0x0a, 0x09, 0x69, 0x66, 0x28, 0x64, 0x61, 0x74, 0x61, 
+0x5b, 0x22, 0x6f, 0x76, 0x65, 0x72, 0x66, 0x6c, 0x6f, 0x77, 0x73, 0x22, 0x5d, 0x20, 0x26, 0x26, 
+0x20, 0x64, 0x61, 0x74, 0x61, 0x5b, 0x22, 0x6f, 0x76, 0x65, 0x72, 0x66, 0x6c, 0x6f, 0x77, 0x73, 
+0x22, 0x5d, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x20, 0x3e, 0x20, 0x30, 0x29, 0x7b, 0x0a, 
+0x09, 0x09, 0x62, 0x6f, 0x64, 0x79, 0x2e, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x28, 0x27, 0x3c, 
+0x70, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3d, 0x22, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3a, 0x20, 
+0x72, 0x65, 0x64, 0x22, 0x3e, 0x3c, 0x62, 0x3e, 0x57, 0x61, 0x72, 0x6e, 0x69, 0x6e, 0x67, 0x3a, 
+0x3c, 0x2f, 0x62, 0x3e, 0x20, 0x74, 0x68, 0x65, 0x73, 0x65, 0x20, 0x6f, 0x70, 0x65, 0x72, 0x61, 
+0x74, 0x69, 0x6f, 0x6e, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x73, 0x20, 0x6f, 0x76, 0x65, 0x72, 
+0x66, 0x6c, 0x6f, 0x77, 0x65, 0x64, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x61, 0x72, 0x65, 0x20, 0x77, 
+0x72, 0x6f, 0x6e, 0x67, 0x3a, 0x20, 0x27, 0x20, 0x2b, 0x0a, 0x09, 0x09, 0x09, 0x64, 0x61, 0x74, 
+0x61, 0x5b, 0x22, 0x6f, 0x76, 0x65, 0x72, 0x66, 0x6c, 0x6f, 0x77, 0x73, 0x22, 0x5d, 0x2e, 0x6a, 
+0x6f, 0x69, 0x6e, 0x28, 0x27, 0x2c, 0x20, 0x27, 0x29, 0x2e, 0x72, 0x65, 0x70, 0x6c, 0x61, 0x63, 
+0x65, 0x28, 0x2f, 0x26, 0x2f, 0x67, 0x2c, 0x20, 0x27, 0x26, 0x61, 0x6d, 0x70, 0x3b, 0x27, 0x29, 
+0x2e, 0x72, 0x65, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x28, 0x2f, 0x3c, 0x2f, 0x67, 0x2c, 0x20, 0x27, 
+0x26, 0x6c, 0x74, 0x3b, 0x27, 0x29, 0x20, 0x2b, 0x20, 0x27, 0x3c, 0x2f, 0x70, 0x3e, 0x27, 0x29, 
+0x3b, 0x0a, 0x09, 0x7d, 0x0a, 0x09, 0x0a, 0x09, 0x66, 0x6f, 0x72, 0x28, 0x76, 0x61, 0x72, 0x20, 
+0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x69, 0x6e, 0x20, 0x53, 0x45, 0x43, 0x54, 0x49, 
+0x4f, 0x4e, 0x53, 0x29, 0x7b, 0x0a, 0x09, 0x09, 0x69, 0x66, 0x28, 0x21, 0x69, 0x73, 0x45, 0x6d, 
+0x70, 0x74, 0x79, 0x28, 0x64, 0x61, 0x74, 0x61, 0x5b, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 
+0x5d, 0x29, 0x29, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x62, 0x6f, 0x64, 0x79, 0x2e, 0x61, 0x70, 0x70, 
+0x65, 0x6e, 0x64, 0x28, 0x22, 0x3c, 0x68, 0x31, 0x3e, 0x22, 0x20, 0x2b, 0x20, 0x53, 0x45, 0x43, 
+0x54, 0x49, 0x4f, 0x4e, 0x53, 0x5b, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x5d, 0x20, 0x2b, 
+0x20, 0x22, 0x3c, 0x2f, 0x68, 0x31, 0x3e, 0x5c, 0x6e, 0x22, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x09, 
+0x2f, 0x2f, 0x66, 0x69, 0x72, 0x73, 0x74, 0x2c, 0x20, 0x73, 0x68, 0x6f, 0x77, 0x20, 0x74, 0x68, 
+0x65, 0x20, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x73, 0x0a, 0x09, 0x09, 0x09, 0x76, 0x61, 0x72, 0x20, 
+0x75, 0x73, 0x65, 0x64, 0x20, 0x3d, 0x20, 0x7b, 0x7d, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x66, 0x6f, 
+0x72, 0x28, 0x76, 0x61, 0x72, 0x20, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x20, 0x69, 0x6e, 0x20, 0x64, 
+0x61, 0x74, 0x61, 0x5b, 0x22, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x73, 0x22, 0x5d, 0x29, 0x7b, 0x0a, 
+0x09, 0x09, 0x09, 0x09, 0x76, 0x61, 0x72, 0x20, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e, 0x74, 0x20, 
+0x3d, 0x20, 0x74, 0x72, 0x75, 0x65, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x66, 0x6f, 0x72, 0x28, 
+0x76, 0x61, 0x72, 0x20, 0x69, 0x3d, 0x30, 0x3b, 0x20, 0x69, 0x20, 0x3c, 0x20, 0x64, 0x61, 0x74, 
+0x61, 0x5b, 0x22, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x73, 0x22, 0x5d, 0x5b, 0x67, 0x72, 0x6f, 0x75, 
+0x70, 0x5d, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3b, 0x20, 0x2b, 0x2b, 0x69, 0x29, 0x7b, 
+0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x69, 0x66, 0x28, 0x21, 0x28, 0x64, 0x61, 0x74, 0x61, 0x5b, 
+0x22, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x73, 0x22, 0x5d, 0x5b, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x5d, 
+0x5b, 0x69, 0x5d, 0x20, 0x69, 0x6e, 0x20, 0x64, 0x61, 0x74, 0x61, 0x5b, 0x73, 0x65, 0x63, 0x74, 
+0x69, 0x6f, 0x6e, 0x5d, 0x29, 0x29, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x70, 0x72, 
+0x65, 0x73, 0x65, 0x6e, 0x74, 0x20, 0x3d, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0a, 0x09, 
+0x09, 0x09, 0x09, 0x09, 0x09, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 
+0x09, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x69, 0x66, 0x28, 
+0x70, 0x72, 0x65, 0x73, 0x65, 0x6e, 0x74, 0x29, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x76, 
+0x61, 0x72, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x3d, 0x20, 0x27, 0x3c, 0x74, 0x61, 0x62, 
+0x6c, 0x65, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3d, 0x22, 0x30, 0x22, 0x20, 0x63, 0x65, 
+0x6c, 0x6c, 0x73, 0x70, 0x61, 0x63, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x31, 0x30, 0x22, 0x3e, 0x27, 
+0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x2b, 0x3d, 0x20, 
+0x27, 0x3c, 0x74, 0x72, 0x3e, 0x3c, 0x74, 0x64, 0x20, 0x63, 0x6f, 0x6c, 0x73, 0x70, 0x61, 0x6e, 
+0x3d, 0x22, 0x33, 0x22, 0x3e, 0x3c, 0x68, 0x32, 0x3e, 0x27, 0x20, 0x2b, 0x20, 0x67, 0x72, 0x6f, 
+0x75, 0x70, 0x20, 0x2b, 0x20, 0x27, 0x3c, 0x2f, 0x68, 0x32, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 
+0x3c, 0x2f, 0x74, 0x72, 0x3e, 0x3c, 0x74, 0x72, 0x3e, 0x27, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 
+0x09, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x2b, 0x3d, 0x20, 0x27, 0x3c, 0x74, 0x64, 0x3e, 0x3c, 
+0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x27, 0x20, 0x2b, 0x20, 0x73, 0x65, 0x63, 0x74, 
+0x69, 0x6f, 0x6e, 0x20, 0x2b, 0x20, 0x22, 0x5f, 0x67, 0x74, 0x5f, 0x22, 0x20, 0x2b, 0x20, 0x67, 
+0x72, 0x6f, 0x75, 0x70, 0x20, 0x2b, 0x20, 0x27, 0x22, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x3d, 
+0x22, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x43, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x65, 0x72, 0x22, 
+0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x27, 0x0a, 0x09, 0x09, 
+0x09, 0x09, 0x09, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x2b, 0x3d, 0x20, 0x27, 0x3c, 0x74, 0x64, 
+0x3e, 0x26, 0x6e, 0x62, 0x73, 0x70, 0x26, 0x6e, 0x62, 0x73, 0x70, 0x26, 0x6e, 0x62, 0x73, 0x70, 
+0x26, 0x6e, 0x62, 0x73, 0x70, 0x26, 0x6e, 0x62, 0x73, 0x70, 0x26, 0x6e, 0x62, 0x73, 0x70, 0x3c, 
+0x2f, 0x74, 0x64, 0x3e, 0x27, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x74, 0x61, 0x62, 0x6c, 
+0x65, 0x20, 0x2b, 0x3d, 0x20, 0x27, 0x3c, 0x74, 0x64, 0x3e, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x69, 
+0x64, 0x3d, 0x22, 0x27, 0x20, 0x2b, 0x20, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x2b, 
+0x20, 0x22, 0x5f, 0x67, 0x5f, 0x22, 0x20, 0x2b, 0x20, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x20, 0x2b, 
+0x20, 0x27, 0x22, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3d, 0x22, 0x77, 0x69, 0x64, 0x74, 0x68, 
+0x3a, 0x36, 0x30, 0x30, 0x70, 0x78, 0x3b, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x33, 0x30, 
+0x30, 0x70, 0x78, 0x3b, 0x22, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 
+0x3e, 0x27, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x2b, 
+0x3d, 0x20, 0x27, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0x3c, 0x2f, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x3e, 
+0x27, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x62, 0x6f, 0x64, 0x79, 0x2e, 0x61, 0x70, 0x70, 
+0x65, 0x6e, 0x64, 0x28, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 
+0x09, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x76, 0x61, 0x72, 0x20, 0x73, 0x65, 0x72, 0x69, 0x65, 
+0x73, 0x20, 0x3d, 0x20, 0x5b, 0x5d, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x66, 0x6f, 0x72, 
+0x28, 0x76, 0x61, 0x72, 0x20, 0x69, 0x3d, 0x30, 0x3b, 0x20, 0x69, 0x20, 0x3c, 0x20, 0x64, 0x61, 
 0x74, 0x61, 0x5b, 0x22, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x73, 0x22, 0x5d, 0x5b, 0x67, 0x72, 0x6f, 
-0x75, 0x70, 0x5d, 0x5b, 0x69, 0x5d, 0x20, 0x69, 0x6e, 0x20, 0x64, 0x61, 0x74, 0x61, 0x5b, 0x73, 
-0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x5d, 0x29, 0x29, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 
-0x09, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e, 0x74, 0x20, 0x3d, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 
-0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x0a, 0x09, 
-0x09, 0x09, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x09, 
-0x69, 0x66, 0x28, 0x70, 0x72, 0x65, 0x73, 0x65, 0x6e, 0x74, 0x29, 0x7b, 0x0a, 0x09, 0x09, 0x09, 
-0x09, 0x09, 0x76, 0x61, 0x72, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x3d, 0x20, 0x27, 0x3c, 
-0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3d, 0x22, 0x30, 0x22, 
-0x20, 0x63, 0x65, 0x6c, 0x6c, 0x73, 0x70, 0x61, 0x63, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x31, 0x30, 
-0x22, 0x3e, 0x27, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 
-0x2b, 0x3d, 0x20, 0x27, 0x3c, 0x74, 0x72, 0x3e, 0x3c, 0x74, 0x64, 0x20, 0x63, 0x6f, 0x6c, 0x73, 
-0x70, 0x61, 0x6e, 0x3d, 0x22, 0x33, 0x22, 0x3e, 0x3c, 0x68, 0x32, 0x3e, 0x27, 0x20, 0x2b, 0x20, 
-0x67, 0x72, 0x6f, 0x75, 0x70, 0x20, 0x2b, 0x20, 0x27, 0x3c, 0x2f, 0x68, 0x32, 0x3e, 0x3c, 0x2f, 
-0x74, 0x64, 0x3e, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0x3c, 0x74, 0x72, 0x3e, 0x27, 0x3b, 0x0a, 0x09, 
-0x09, 0x09, 0x09, 0x09, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x2b, 0x3d, 0x20, 0x27, 0x3c, 0x74, 
-0x64, 0x3e, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x27, 0x20, 0x2b, 0x20, 0x73, 
-0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x2b, 0x20, 0x22, 0x5f, 0x67, 0x74, 0x5f, 0x22, 0x20, 
-0x2b, 0x20, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x20, 0x2b, 0x20, 0x27, 0x22, 0x20, 0x63, 0x6c, 0x61, 
-0x73, 0x73, 0x3d, 0x22, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x43, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 
-0x65, 0x72, 0x22, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x27, 
-0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x2b, 0x3d, 0x20, 0x27, 
-0x3c, 0x74, 0x64, 0x3e, 0x26, 0x6e, 0x62, 0x73, 0x70, 0x26, 0x6e, 0x62, 0x73, 0x70, 0x26, 0x6e, 
-0x62, 0x73, 0x70, 0x26, 0x6e, 0x62, 0x73, 0x70, 0x26, 0x6e, 0x62, 0x73, 0x70, 0x26, 0x6e, 0x62, 
-0x73, 0x70, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x27, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x74, 
+0x75, 0x70, 0x5d, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3b, 0x20, 0x2b, 0x2b, 0x69, 0x29, 
+0x7b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x76, 0x61, 0x72, 0x20, 0x73, 0x65, 0x71, 0x75, 
+0x65, 0x6e, 0x63, 0x65, 0x20, 0x3d, 0x20, 0x64, 0x61, 0x74, 0x61, 0x5b, 0x22, 0x67, 0x72, 0x6f, 
+0x75, 0x70, 0x73, 0x22, 0x5d, 0x5b, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x5d, 0x5b, 0x69, 0x5d, 0x3b, 
+0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x75, 0x73, 0x65, 0x64, 0x5b, 0x73, 0x65, 0x71, 0x75, 
+0x65, 0x6e, 0x63, 0x65, 0x5d, 0x20, 0x3d, 0x20, 0x74, 0x72, 0x75, 0x65, 0x3b, 0x0a, 0x09, 0x09, 
+0x09, 0x09, 0x09, 0x09, 0x73, 0x65, 0x72, 0x69, 0x65, 0x73, 0x2e, 0x70, 0x75, 0x73, 0x68, 0x28, 
+0x7b, 0x22, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x22, 0x3a, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 
+0x63, 0x65, 0x2c, 0x20, 0x22, 0x64, 0x61, 0x74, 0x61, 0x22, 0x3a, 0x20, 0x64, 0x61, 0x74, 0x61, 
+0x5b, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x5d, 0x5b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 
+0x63, 0x65, 0x5d, 0x7d, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x09, 
+0x09, 0x09, 0x09, 0x24, 0x28, 0x22, 0x23, 0x22, 0x20, 0x2b, 0x20, 0x73, 0x65, 0x63, 0x74, 0x69, 
+0x6f, 0x6e, 0x20, 0x2b, 0x20, 0x22, 0x5f, 0x67, 0x74, 0x5f, 0x22, 0x20, 0x2b, 0x20, 0x67, 0x72, 
+0x6f, 0x75, 0x70, 0x29, 0x2e, 0x68, 0x74, 0x6d, 0x6c, 0x28, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 
+0x74, 0x65, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x28, 0x73, 0x65, 0x72, 0x69, 0x65, 0x73, 0x29, 0x29, 
+0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x24, 0x2e, 0x70, 0x6c, 0x6f, 0x74, 0x28, 0x24, 0x28, 
+0x22, 0x23, 0x22, 0x20, 0x2b, 0x20, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x2b, 0x20, 
+0x22, 0x5f, 0x67, 0x5f, 0x22, 0x20, 0x2b, 0x20, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x29, 0x2c, 0x20, 
+0x73, 0x65, 0x72, 0x69, 0x65, 0x73, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7d, 0x0a, 0x09, 
+0x09, 0x09, 0x09, 0x0a, 0x09, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x2f, 0x2f, 0x6e, 0x65, 
+0x78, 0x74, 0x2c, 0x20, 0x73, 0x68, 0x6f, 0x77, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x6d, 
+0x61, 0x69, 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x63, 0x65, 0x73, 
+0x0a, 0x09, 0x09, 0x09, 0x66, 0x6f, 0x72, 0x28, 0x76, 0x61, 0x72, 0x20, 0x73, 0x65, 0x71, 0x75, 
+0x65, 0x6e, 0x63, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x64, 0x61, 0x74, 0x61, 0x5b, 0x73, 0x65, 0x63, 
+0x74, 0x69, 0x6f, 0x6e, 0x5d, 0x29, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x69, 0x66, 0x28, 0x21, 
+0x28, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x63, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x75, 0x73, 0x65, 
+0x64, 0x29, 0x29, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x76, 0x61, 0x72, 0x20, 0x74, 0x61, 
+0x62, 0x6c, 0x65, 0x20, 0x3d, 0x20, 0x27, 0x3c, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x62, 0x6f, 
+0x72, 0x64, 0x65, 0x72, 0x3d, 0x22, 0x30, 0x22, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x73, 0x70, 0x61, 
+0x63, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x31, 0x30, 0x22, 0x3e, 0x27, 0x3b, 0x0a, 0x09, 0x09, 0x09, 
+0x09, 0x09, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x2b, 0x3d, 0x20, 0x27, 0x3c, 0x74, 0x72, 0x3e, 
+0x3c, 0x74, 0x64, 0x20, 0x63, 0x6f, 0x6c, 0x73, 0x70, 0x61, 0x6e, 0x3d, 0x22, 0x32, 0x22, 0x3e, 
+0x3c, 0x68, 0x32, 0x3e, 0x27, 0x20, 0x2b, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x63, 0x65, 
+0x20, 0x2b, 0x20, 0x27, 0x3c, 0x2f, 0x68, 0x32, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 0x2f, 
+0x74, 0x72, 0x3e, 0x3c, 0x74, 0x72, 0x3e, 0x27, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x74, 
 0x61, 0x62, 0x6c, 0x65, 0x20, 0x2b, 0x3d, 0x20, 0x27, 0x3c, 0x74, 0x64, 0x3e, 0x3c, 0x64, 0x69, 
 0x76, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x27, 0x20, 0x2b, 0x20, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 
-0x6e, 0x20, 0x2b, 0x20, 0x22, 0x5f, 0x67, 0x5f, 0x22, 0x20, 0x2b, 0x20, 0x67, 0x72, 0x6f, 0x75, 
-0x70, 0x20, 0x2b, 0x20, 0x27, 0x22, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3d, 0x22, 0x77, 0x69, 
-0x64, 0x74, 0x68, 0x3a, 0x36, 0x30, 0x30, 0x70, 0x78, 0x3b, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 
-0x3a, 0x33, 0x30, 0x30, 0x70, 0x78, 0x3b, 0x22, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x3c, 
-0x2f, 0x74, 0x64, 0x3e, 0x27, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x74, 0x61, 0x62, 0x6c, 
-0x65, 0x20, 0x2b, 0x3d, 0x20, 0x27, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0x3c, 0x2f, 0x74, 0x61, 0x62, 
-0x6c, 0x65, 0x3e, 0x27, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x62, 0x6f, 0x64, 0x79, 0x2e, 
-0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x28, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x29, 0x3b, 0x0a, 0x09, 
-0x09, 0x09, 0x09, 0x09, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x76, 0x61, 0x72, 0x20, 0x73, 0x65, 
-0x72, 0x69, 0x65, 0x73, 0x20, 0x3d, 0x20, 0x5b, 0x5d, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 
-0x66, 0x6f, 0x72, 0x28, 0x76, 0x61, 0x72, 0x20, 0x69, 0x3d, 0x30, 0x3b, 0x20, 0x69, 0x20, 0x3c, 
-0x20, 0x64, 0x61, 0x74, 0x61, 0x5b, 0x22, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x73, 0x22, 0x5d, 0x5b, 
-0x67, 0x72, 0x6f, 0x75, 0x70, 0x5d, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3b, 0x20, 0x2b, 
-0x2b, 0x69, 0x29, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x76, 0x61, 0x72, 0x20, 0x73, 
-0x65, 0x71, 0x75, 0x65, 0x6e, 0x63, 0x65, 0x20, 0x3d, 0x20, 0x64, 0x61, 0x74, 0x61, 0x5b, 0x22, 
-0x67, 0x72, 0x6f, 0x75, 0x70, 0x73, 0x22, 0x5d, 0x5b, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x5d, 0x5b, 
-0x69, 0x5d, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x75, 0x73, 0x65, 0x64, 0x5b, 0x73, 
-0x65, 0x71, 0x75, 0x65, 0x6e, 0x63, 0x65, 0x5d, 0x20, 0x3d, 0x20, 0x74, 0x72, 0x75, 0x65, 0x3b, 
-0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x73, 0x65, 0x72, 0x69, 0x65, 0x73, 0x2e, 0x70, 0x75, 
-0x73, 0x68, 0x28, 0x7b, 0x22, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x22, 0x3a, 0x20, 0x73, 0x65, 0x71, 
-0x75, 0x65, 0x6e, 0x63, 0x65, 0x2c, 0x20, 0x22, 0x64, 0x61, 0x74, 0x61, 0x22, 0x3a, 0x20, 0x64, 
-0x61, 0x74, 0x61, 0x5b, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x5d, 0x5b, 0x73, 0x65, 0x71, 
-0x75, 0x65, 0x6e, 0x63, 0x65, 0x5d, 0x7d, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x7d, 
-0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x24, 0x28, 0x22, 0x23, 0x22, 0x20, 0x2b, 0x20, 0x73, 0x65, 
-0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x2b, 0x20, 0x22, 0x5f, 0x67, 0x74, 0x5f, 0x22, 0x20, 0x2b, 
-0x20, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x29, 0x2e, 0x68, 0x74, 0x6d, 0x6c, 0x28, 0x67, 0x65, 0x6e, 
-0x65, 0x72, 0x61, 0x74, 0x65, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x28, 0x73, 0x65, 0x72, 0x69, 0x65, 
-0x73, 0x29, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x24, 0x2e, 0x70, 0x6c, 0x6f, 0x74, 
-0x28, 0x24, 0x28, 0x22, 0x23, 0x22, 0x20, 0x2b, 0x20, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 
-0x20, 0x2b, 0x20, 0x22, 0x5f, 0x67, 0x5f, 0x22, 0x20, 0x2b, 0x20, 0x67, 0x72, 0x6f, 0x75, 0x70, 
-0x29, 0x2c, 0x20, 0x73, 0x65, 0x72, 0x69, 0x65, 0x73, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 
-0x7d, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x0a, 0x09, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x2f, 
-0x2f, 0x6e, 0x65, 0x78, 0x74, 0x2c, 0x20, 0x73, 0x68, 0x6f, 0x77, 0x20, 0x74, 0x68, 0x65, 0x20, 
-0x72, 0x65, 0x6d, 0x61, 0x69, 0x6e, 0x69, 0x6e, 0x67, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 
-0x63, 0x65, 0x73, 0x0a, 0x09, 0x09, 0x09, 0x66, 0x6f, 0x72, 0x28, 0x76, 0x61, 0x72, 0x20, 0x73, 
-0x65, 0x71, 0x75, 0x65, 0x6e, 0x63, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x64, 0x61, 0x74, 0x61, 0x5b, 
-0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x5d, 0x29, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x69, 
-0x66, 0x28, 0x21, 0x28, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x63, 0x65, 0x20, 0x69, 0x6e, 0x20, 
-0x75, 0x73, 0x65, 0x64, 0x29, 0x29, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x76, 0x61, 0x72, 
-0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x3d, 0x20, 0x27, 0x3c, 0x74, 0x61, 0x62, 0x6c, 0x65, 
-0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3d, 0x22, 0x30, 0x22, 0x20, 0x63, 0x65, 0x6c, 0x6c, 
-0x73, 0x70, 0x61, 0x63, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x31, 0x30, 0x22, 0x3e, 0x27, 0x3b, 0x0a, 
+0x6e, 0x20, 0x2b, 0x20, 0x27, 0x5f, 0x73, 0x74, 0x5f, 0x27, 0x20, 0x2b, 0x20, 0x73, 0x65, 0x71, 
+0x75, 0x65, 0x6e, 0x63, 0x65, 0x20, 0x2b, 0x20, 0x27, 0x22, 0x20, 0x63, 0x6c, 0x61, 0x73, 0x73, 
+0x3d, 0x22, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x43, 0x6f, 0x6e, 0x74, 0x61, 0x69, 0x6e, 0x65, 0x72, 
+0x22, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x27, 0x3b, 0x0a, 
+0x09, 0x09, 0x09, 0x09, 0x09, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x2b, 0x3d, 0x20, 0x27, 0x3c, 
+0x74, 0x64, 0x3e, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x27, 0x20, 0x2b, 0x20, 
+0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x2b, 0x20, 0x22, 0x5f, 0x73, 0x5f, 0x22, 0x20, 
+0x2b, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x63, 0x65, 0x20, 0x2b, 0x20, 0x27, 0x22, 0x20, 
+0x73, 0x74, 0x79, 0x6c, 0x65, 0x3d, 0x22, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x36, 0x30, 0x30, 
+0x70, 0x78, 0x3b, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x33, 0x30, 0x30, 0x70, 0x78, 0x3b, 
+0x22, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x27, 0x3b, 0x0a, 
 0x09, 0x09, 0x09, 0x09, 0x09, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x2b, 0x3d, 0x20, 0x27, 0x3c, 
-0x74, 0x72, 0x3e, 0x3c, 0x74, 0x64, 0x20, 0x63, 0x6f, 0x6c, 0x73, 0x70, 0x61, 0x6e, 0x3d, 0x22, 
-0x32, 0x22, 0x3e, 0x3c, 0x68, 0x32, 0x3e, 0x27, 0x20, 0x2b, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 
-0x6e, 0x63, 0x65, 0x20, 0x2b, 0x20, 0x27, 0x3c, 0x2f, 0x68, 0x32, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 
-0x3e, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0x3c, 0x74, 0x72, 0x3e, 0x27, 0x3b, 0x0a, 0x09, 0x09, 0x09, 
-0x09, 0x09, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x2b, 0x3d, 0x20, 0x27, 0x3c, 0x74, 0x64, 0x3e, 
-0x3c, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x27, 0x20, 0x2b, 0x20, 0x73, 0x65, 0x63, 
-0x74, 0x69, 0x6f, 0x6e, 0x20, 0x2b, 0x20, 0x27, 0x5f, 0x73, 0x74, 0x5f, 0x27, 0x20, 0x2b, 0x20, 
-0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x63, 0x65, 0x20, 0x2b, 0x20, 0x27, 0x22, 0x20, 0x63, 0x6c, 
+0x2f, 0x74, 0x72, 0x3e, 0x3c, 0x2f, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x27, 0x0a, 0x09, 0x09, 
+0x09, 0x09, 0x09, 0x62, 0x6f, 0x64, 0x79, 0x2e, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x28, 0x74, 
+0x61, 0x62, 0x6c, 0x65, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0a, 0x09, 0x09, 0x09, 
+0x09, 0x09, 0x73, 0x65, 0x72, 0x69, 0x65, 0x73, 0x20, 0x3d, 0x20, 0x5b, 0x7b, 0x22, 0x6c, 0x61, 
+0x62, 0x65, 0x6c, 0x22, 0x3a, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x63, 0x65, 0x2c, 0x20, 
+0x22, 0x64, 0x61, 0x74, 0x61, 0x22, 0x3a, 0x20, 0x64, 0x61, 0x74, 0x61, 0x5b, 0x73, 0x65, 0x63, 
+0x74, 0x69, 0x6f, 0x6e, 0x5d, 0x5b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x63, 0x65, 0x5d, 0x7d, 
+0x5d, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x24, 0x28, 0x22, 0x23, 0x22, 0x20, 0x2b, 0x20, 
+0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x2b, 0x20, 0x22, 0x5f, 0x73, 0x74, 0x5f, 0x22, 
+0x20, 0x2b, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x63, 0x65, 0x29, 0x2e, 0x68, 0x74, 0x6d, 
+0x6c, 0x28, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x65, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x28, 
+0x73, 0x65, 0x72, 0x69, 0x65, 0x73, 0x29, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x24, 
+0x2e, 0x70, 0x6c, 0x6f, 0x74, 0x28, 0x24, 0x28, 0x22, 0x23, 0x22, 0x20, 0x2b, 0x20, 0x73, 0x65, 
+0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x2b, 0x20, 0x22, 0x5f, 0x73, 0x5f, 0x22, 0x20, 0x2b, 0x20, 
+0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x63, 0x65, 0x29, 0x2c, 0x20, 0x73, 0x65, 0x72, 0x69, 0x65, 
+0x73, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x7d, 0x0a, 0x09, 
+0x09, 0x7d, 0x0a, 0x09, 0x7d, 0x0a, 0x09, 0x0a, 0x09, 0x2f, 0x2f, 0x67, 0x72, 0x6f, 0x75, 0x70, 
+0x73, 0x20, 0x6d, 0x69, 0x78, 0x69, 0x6e, 0x67, 0x20, 0x73, 0x65, 0x72, 0x69, 0x65, 0x73, 0x20, 
+0x66, 0x72, 0x6f, 0x6d, 0x20, 0x64, 0x69, 0x66, 0x66, 0x65, 0x72, 0x65, 0x6e, 0x74, 0x20, 0x73, 
+0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x73, 0x68, 0x61, 0x72, 0x65, 0x20, 0x61, 0x20, 
+0x63, 0x68, 0x61, 0x72, 0x74, 0x2c, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x65, 0x63, 0x74, 0x69, 
+0x6f, 0x6e, 0x0a, 0x09, 0x2f, 0x2f, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x69, 0x72, 
+0x73, 0x74, 0x20, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x20, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 
+0x20, 0x6c, 0x65, 0x66, 0x74, 0x20, 0x61, 0x78, 0x69, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x74, 
+0x68, 0x65, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x73, 0x20, 0x6f, 0x6e, 0x20, 0x74, 0x68, 0x65, 
+0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x61, 0x78, 0x69, 0x73, 0x0a, 0x09, 0x76, 0x61, 0x72, 
+0x20, 0x6d, 0x69, 0x78, 0x65, 0x64, 0x53, 0x68, 0x6f, 0x77, 0x6e, 0x20, 0x3d, 0x20, 0x66, 0x61, 
+0x6c, 0x73, 0x65, 0x3b, 0x0a, 0x09, 0x66, 0x6f, 0x72, 0x28, 0x76, 0x61, 0x72, 0x20, 0x67, 0x72, 
+0x6f, 0x75, 0x70, 0x20, 0x69, 0x6e, 0x20, 0x64, 0x61, 0x74, 0x61, 0x5b, 0x22, 0x67, 0x72, 0x6f, 
+0x75, 0x70, 0x73, 0x22, 0x5d, 0x29, 0x7b, 0x0a, 0x09, 0x09, 0x76, 0x61, 0x72, 0x20, 0x6d, 0x65, 
+0x6d, 0x62, 0x65, 0x72, 0x73, 0x20, 0x3d, 0x20, 0x64, 0x61, 0x74, 0x61, 0x5b, 0x22, 0x67, 0x72, 
+0x6f, 0x75, 0x70, 0x73, 0x22, 0x5d, 0x5b, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x5d, 0x3b, 0x0a, 0x09, 
+0x09, 0x76, 0x61, 0x72, 0x20, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x20, 0x3d, 0x20, 
+0x5b, 0x5d, 0x3b, 0x0a, 0x09, 0x09, 0x76, 0x61, 0x72, 0x20, 0x6d, 0x69, 0x78, 0x65, 0x64, 0x20, 
+0x3d, 0x20, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0a, 0x09, 0x09, 0x66, 0x6f, 0x72, 0x28, 0x76, 
+0x61, 0x72, 0x20, 0x69, 0x3d, 0x30, 0x3b, 0x20, 0x69, 0x20, 0x3c, 0x20, 0x6d, 0x65, 0x6d, 0x62, 
+0x65, 0x72, 0x73, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3b, 0x20, 0x2b, 0x2b, 0x69, 0x29, 
+0x7b, 0x0a, 0x09, 0x09, 0x09, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2e, 0x70, 0x75, 
+0x73, 0x68, 0x28, 0x6e, 0x75, 0x6c, 0x6c, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x66, 0x6f, 0x72, 
+0x28, 0x76, 0x61, 0x72, 0x20, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x69, 0x6e, 0x20, 
+0x53, 0x45, 0x43, 0x54, 0x49, 0x4f, 0x4e, 0x53, 0x29, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x69, 
+0x66, 0x28, 0x64, 0x61, 0x74, 0x61, 0x5b, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x5d, 0x20, 
+0x26, 0x26, 0x20, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x5b, 0x69, 0x5d, 0x20, 0x69, 0x6e, 
+0x20, 0x64, 0x61, 0x74, 0x61, 0x5b, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x5d, 0x29, 0x7b, 
+0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x5b, 0x69, 
+0x5d, 0x20, 0x3d, 0x20, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x3b, 0x0a, 0x09, 0x09, 0x09, 
+0x09, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x69, 0x66, 0x28, 0x73, 0x65, 
+0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x5b, 0x69, 0x5d, 0x20, 0x3d, 0x3d, 0x20, 0x6e, 0x75, 0x6c, 
+0x6c, 0x29, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x6d, 0x69, 0x78, 0x65, 0x64, 0x20, 0x3d, 0x20, 
+0x66, 0x61, 0x6c, 0x73, 0x65, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x62, 0x72, 0x65, 0x61, 0x6b, 
+0x3b, 0x0a, 0x09, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x69, 0x66, 0x28, 0x73, 0x65, 0x63, 
+0x74, 0x69, 0x6f, 0x6e, 0x73, 0x5b, 0x69, 0x5d, 0x20, 0x21, 0x3d, 0x20, 0x73, 0x65, 0x63, 0x74, 
+0x69, 0x6f, 0x6e, 0x73, 0x5b, 0x30, 0x5d, 0x29, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x6d, 0x69, 
+0x78, 0x65, 0x64, 0x20, 0x3d, 0x20, 0x74, 0x72, 0x75, 0x65, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x7d, 
+0x0a, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x09, 0x69, 0x66, 0x28, 0x6d, 0x69, 0x78, 0x65, 0x64, 0x29, 
+0x7b, 0x0a, 0x09, 0x09, 0x09, 0x69, 0x66, 0x28, 0x21, 0x6d, 0x69, 0x78, 0x65, 0x64, 0x53, 0x68, 
+0x6f, 0x77, 0x6e, 0x29, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x62, 0x6f, 0x64, 0x79, 0x2e, 0x61, 
+0x70, 0x70, 0x65, 0x6e, 0x64, 0x28, 0x22, 0x3c, 0x68, 0x31, 0x3e, 0x4d, 0x69, 0x78, 0x65, 0x64, 
+0x20, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x73, 0x3c, 0x2f, 0x68, 0x31, 0x3e, 0x5c, 0x6e, 0x22, 0x29, 
+0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x6d, 0x69, 0x78, 0x65, 0x64, 0x53, 0x68, 0x6f, 0x77, 0x6e, 
+0x20, 0x3d, 0x20, 0x74, 0x72, 0x75, 0x65, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x09, 
+0x09, 0x76, 0x61, 0x72, 0x20, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x3d, 0x20, 0x27, 0x3c, 0x74, 
+0x61, 0x62, 0x6c, 0x65, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3d, 0x22, 0x30, 0x22, 0x20, 
+0x63, 0x65, 0x6c, 0x6c, 0x73, 0x70, 0x61, 0x63, 0x69, 0x6e, 0x67, 0x3d, 0x22, 0x31, 0x30, 0x22, 
+0x3e, 0x27, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x2b, 0x3d, 0x20, 
+0x27, 0x3c, 0x74, 0x72, 0x3e, 0x3c, 0x74, 0x64, 0x20, 0x63, 0x6f, 0x6c, 0x73, 0x70, 0x61, 0x6e, 
+0x3d, 0x22, 0x33, 0x22, 0x3e, 0x3c, 0x68, 0x32, 0x3e, 0x27, 0x20, 0x2b, 0x20, 0x67, 0x72, 0x6f, 
+0x75, 0x70, 0x20, 0x2b, 0x20, 0x27, 0x3c, 0x2f, 0x68, 0x32, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 
+0x3c, 0x2f, 0x74, 0x72, 0x3e, 0x3c, 0x74, 0x72, 0x3e, 0x27, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x74, 
+0x61, 0x62, 0x6c, 0x65, 0x20, 0x2b, 0x3d, 0x20, 0x27, 0x3c, 0x74, 0x64, 0x3e, 0x3c, 0x64, 0x69, 
+0x76, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x6d, 0x69, 0x78, 0x65, 0x64, 0x5f, 0x67, 0x74, 0x5f, 0x27, 
+0x20, 0x2b, 0x20, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x20, 0x2b, 0x20, 0x27, 0x22, 0x20, 0x63, 0x6c, 
 0x61, 0x73, 0x73, 0x3d, 0x22, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x43, 0x6f, 0x6e, 0x74, 0x61, 0x69, 
 0x6e, 0x65, 0x72, 0x22, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 
-0x27, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x2b, 0x3d, 
-0x20, 0x27, 0x3c, 0x74, 0x64, 0x3e, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3d, 0x22, 0x27, 
-0x20, 0x2b, 0x20, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x2b, 0x20, 0x22, 0x5f, 0x73, 
-0x5f, 0x22, 0x20, 0x2b, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x63, 0x65, 0x20, 0x2b, 0x20, 
-0x27, 0x22, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3d, 0x22, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 
-0x36, 0x30, 0x30, 0x70, 0x78, 0x3b, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x33, 0x30, 0x30, 
-0x70, 0x78, 0x3b, 0x22, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 0x76, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 
-0x27, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x2b, 0x3d, 
-0x20, 0x27, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0x3c, 0x2f, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x27, 
-0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x62, 0x6f, 0x64, 0x79, 0x2e, 0x61, 0x70, 0x70, 0x65, 0x6e, 
-0x64, 0x28, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0a, 
-0x09, 0x09, 0x09, 0x09, 0x09, 0x73, 0x65, 0x72, 0x69, 0x65, 0x73, 0x20, 0x3d, 0x20, 0x5b, 0x7b, 
-0x22, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x22, 0x3a, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x63, 
-0x65, 0x2c, 0x20, 0x22, 0x64, 0x61, 0x74, 0x61, 0x22, 0x3a, 0x20, 0x64, 0x61, 0x74, 0x61, 0x5b, 
-0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x5d, 0x5b, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x63, 
-0x65, 0x5d, 0x7d, 0x5d, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x24, 0x28, 0x22, 0x23, 0x22, 
-0x20, 0x2b, 0x20, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x2b, 0x20, 0x22, 0x5f, 0x73, 
-0x74, 0x5f, 0x22, 0x20, 0x2b, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x63, 0x65, 0x29, 0x2e, 
-0x68, 0x74, 0x6d, 0x6c, 0x28, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x65, 0x54, 0x61, 0x62, 
-0x6c, 0x65, 0x28, 0x73, 0x65, 0x72, 0x69, 0x65, 0x73, 0x29, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x09, 
-0x09, 0x09, 0x24, 0x2e, 0x70, 0x6c, 0x6f, 0x74, 0x28, 0x24, 0x28, 0x22, 0x23, 0x22, 0x20, 0x2b, 
-0x20, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x2b, 0x20, 0x22, 0x5f, 0x73, 0x5f, 0x22, 
-0x20, 0x2b, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6e, 0x63, 0x65, 0x29, 0x2c, 0x20, 0x73, 0x65, 
-0x72, 0x69, 0x65, 0x73, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x09, 0x09, 
-0x7d, 0x0a, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x7d, 0x0a, 0x09, 0x0a, 0x7d, 0x29, 0x3b, 0x0a, 0x3c, 
-0x2f, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x0a, 0x0a, 0x20, 0x3c, 0x2f, 0x62, 0x6f, 0x64, 
-0x79, 0x3e, 0x0a, 0x3c, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 0x0a
+0x27, 0x0a, 0x09, 0x09, 0x09, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x2b, 0x3d, 0x20, 0x27, 0x3c, 
+0x74, 0x64, 0x3e, 0x26, 0x6e, 0x62, 0x73, 0x70, 0x26, 0x6e, 0x62, 0x73, 0x70, 0x26, 0x6e, 0x62, 
+0x73, 0x70, 0x26, 0x6e, 0x62, 0x73, 0x70, 0x26, 0x6e, 0x62, 0x73, 0x70, 0x26, 0x6e, 0x62, 0x73, 
+0x70, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x27, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x74, 0x61, 0x62, 0x6c, 
+0x65, 0x20, 0x2b, 0x3d, 0x20, 0x27, 0x3c, 0x74, 0x64, 0x3e, 0x3c, 0x64, 0x69, 0x76, 0x20, 0x69, 
+0x64, 0x3d, 0x22, 0x6d, 0x69, 0x78, 0x65, 0x64, 0x5f, 0x67, 0x5f, 0x27, 0x20, 0x2b, 0x20, 0x67, 
+0x72, 0x6f, 0x75, 0x70, 0x20, 0x2b, 0x20, 0x27, 0x22, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3d, 
+0x22, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3a, 0x36, 0x30, 0x30, 0x70, 0x78, 0x3b, 0x68, 0x65, 0x69, 
+0x67, 0x68, 0x74, 0x3a, 0x33, 0x30, 0x30, 0x70, 0x78, 0x3b, 0x22, 0x3e, 0x3c, 0x2f, 0x64, 0x69, 
+0x76, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x27, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x74, 0x61, 0x62, 
+0x6c, 0x65, 0x20, 0x2b, 0x3d, 0x20, 0x27, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0x3c, 0x2f, 0x74, 0x61, 
+0x62, 0x6c, 0x65, 0x3e, 0x27, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x62, 0x6f, 0x64, 0x79, 0x2e, 0x61, 
+0x70, 0x70, 0x65, 0x6e, 0x64, 0x28, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x29, 0x3b, 0x0a, 0x09, 0x09, 
+0x09, 0x0a, 0x09, 0x09, 0x09, 0x76, 0x61, 0x72, 0x20, 0x73, 0x65, 0x72, 0x69, 0x65, 0x73, 0x20, 
+0x3d, 0x20, 0x5b, 0x5d, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x66, 0x6f, 0x72, 0x28, 0x76, 0x61, 0x72, 
+0x20, 0x69, 0x3d, 0x30, 0x3b, 0x20, 0x69, 0x20, 0x3c, 0x20, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 
+0x73, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3b, 0x20, 0x2b, 0x2b, 0x69, 0x29, 0x7b, 0x0a, 
+0x09, 0x09, 0x09, 0x09, 0x76, 0x61, 0x72, 0x20, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x20, 0x3d, 0x20, 
+0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x5b, 0x69, 0x5d, 0x20, 0x3d, 0x3d, 0x20, 0x22, 
+0x74, 0x69, 0x6d, 0x65, 0x73, 0x22, 0x3f, 0x20, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x5b, 
+0x69, 0x5d, 0x20, 0x2b, 0x20, 0x22, 0x20, 0x28, 0x6e, 0x73, 0x29, 0x22, 0x3a, 0x20, 0x6d, 0x65, 
+0x6d, 0x62, 0x65, 0x72, 0x73, 0x5b, 0x69, 0x5d, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x76, 0x61, 
+0x72, 0x20, 0x61, 0x78, 0x69, 0x73, 0x20, 0x3d, 0x20, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 
+0x73, 0x5b, 0x69, 0x5d, 0x20, 0x3d, 0x3d, 0x20, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 
+0x5b, 0x30, 0x5d, 0x3f, 0x20, 0x31, 0x3a, 0x20, 0x32, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x73, 
+0x65, 0x72, 0x69, 0x65, 0x73, 0x2e, 0x70, 0x75, 0x73, 0x68, 0x28, 0x7b, 0x22, 0x6c, 0x61, 0x62, 
+0x65, 0x6c, 0x22, 0x3a, 0x20, 0x6c, 0x61, 0x62, 0x65, 0x6c, 0x2c, 0x20, 0x22, 0x64, 0x61, 0x74, 
+0x61, 0x22, 0x3a, 0x20, 0x64, 0x61, 0x74, 0x61, 0x5b, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 
+0x73, 0x5b, 0x69, 0x5d, 0x5d, 0x5b, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 0x73, 0x5b, 0x69, 0x5d, 
+0x5d, 0x2c, 0x20, 0x22, 0x79, 0x61, 0x78, 0x69, 0x73, 0x22, 0x3a, 0x20, 0x61, 0x78, 0x69, 0x73, 
+0x7d, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x24, 0x28, 0x22, 0x23, 
+0x6d, 0x69, 0x78, 0x65, 0x64, 0x5f, 0x67, 0x74, 0x5f, 0x22, 0x20, 0x2b, 0x20, 0x67, 0x72, 0x6f, 
+0x75, 0x70, 0x29, 0x2e, 0x68, 0x74, 0x6d, 0x6c, 0x28, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 
+0x65, 0x54, 0x61, 0x62, 0x6c, 0x65, 0x28, 0x73, 0x65, 0x72, 0x69, 0x65, 0x73, 0x29, 0x29, 0x3b, 
+0x0a, 0x09, 0x09, 0x09, 0x24, 0x2e, 0x70, 0x6c, 0x6f, 0x74, 0x28, 0x24, 0x28, 0x22, 0x23, 0x6d, 
+0x69, 0x78, 0x65, 0x64, 0x5f, 0x67, 0x5f, 0x22, 0x20, 0x2b, 0x20, 0x67, 0x72, 0x6f, 0x75, 0x70, 
+0x29, 0x2c, 0x20, 0x73, 0x65, 0x72, 0x69, 0x65, 0x73, 0x2c, 0x20, 0x7b, 0x22, 0x79, 0x61, 0x78, 
+0x65, 0x73, 0x22, 0x3a, 0x20, 0x5b, 0x7b, 0x7d, 0x2c, 0x20, 0x7b, 0x22, 0x70, 0x6f, 0x73, 0x69, 
+0x74, 0x69, 0x6f, 0x6e, 0x22, 0x3a, 0x20, 0x22, 0x72, 0x69, 0x67, 0x68, 0x74, 0x22, 0x7d, 0x5d, 
+0x7d, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x7d, 0x0a, 0x09, 0x0a, 0x09, 0x2f, 0x2f, 
+0x65, 0x76, 0x65, 0x72, 0x79, 0x20, 0x67, 0x72, 0x69, 0x64, 0x20, 0x61, 0x73, 0x20, 0x61, 0x20, 
+0x68, 0x65, 0x61, 0x74, 0x6d, 0x61, 0x70, 0x2c, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x20, 0x67, 0x72, 
+0x65, 0x65, 0x6e, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x69, 0x74, 0x73, 0x20, 0x73, 0x6d, 0x61, 0x6c, 
+0x6c, 0x65, 0x73, 0x74, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x72, 0x65, 
+0x64, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x69, 0x74, 0x73, 0x20, 0x6c, 0x61, 0x72, 0x67, 0x65, 0x73, 
+0x74, 0x2c, 0x0a, 0x09, 0x2f, 0x2f, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x62, 
+0x65, 0x73, 0x74, 0x20, 0x79, 0x20, 0x61, 0x74, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79, 0x20, 0x78, 
+0x20, 0x69, 0x6e, 0x20, 0x62, 0x6f, 0x6c, 0x64, 0x0a, 0x09, 0x66, 0x6f, 0x72, 0x28, 0x76, 0x61, 
+0x72, 0x20, 0x67, 0x72, 0x69, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x64, 0x61, 0x74, 0x61, 0x5b, 0x22, 
+0x67, 0x72, 0x69, 0x64, 0x73, 0x22, 0x5d, 0x29, 0x7b, 0x0a, 0x09, 0x09, 0x76, 0x61, 0x72, 0x20, 
+0x67, 0x20, 0x3d, 0x20, 0x64, 0x61, 0x74, 0x61, 0x5b, 0x22, 0x67, 0x72, 0x69, 0x64, 0x73, 0x22, 
+0x5d, 0x5b, 0x67, 0x72, 0x69, 0x64, 0x5d, 0x3b, 0x0a, 0x09, 0x09, 0x76, 0x61, 0x72, 0x20, 0x6c, 
+0x6f, 0x77, 0x20, 0x3d, 0x20, 0x6e, 0x75, 0x6c, 0x6c, 0x2c, 0x20, 0x68, 0x69, 0x67, 0x68, 0x20, 
+0x3d, 0x20, 0x6e, 0x75, 0x6c, 0x6c, 0x3b, 0x0a, 0x09, 0x09, 0x66, 0x6f, 0x72, 0x28, 0x76, 0x61, 
+0x72, 0x20, 0x6a, 0x3d, 0x30, 0x3b, 0x20, 0x6a, 0x20, 0x3c, 0x20, 0x67, 0x5b, 0x22, 0x76, 0x61, 
+0x6c, 0x75, 0x65, 0x73, 0x22, 0x5d, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3b, 0x20, 0x2b, 
+0x2b, 0x6a, 0x29, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x66, 0x6f, 0x72, 0x28, 0x76, 0x61, 0x72, 0x20, 
+0x69, 0x3d, 0x30, 0x3b, 0x20, 0x69, 0x20, 0x3c, 0x20, 0x67, 0x5b, 0x22, 0x76, 0x61, 0x6c, 0x75, 
+0x65, 0x73, 0x22, 0x5d, 0x5b, 0x6a, 0x5d, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3b, 0x20, 
+0x2b, 0x2b, 0x69, 0x29, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x76, 0x61, 0x72, 0x20, 0x76, 0x20, 
+0x3d, 0x20, 0x67, 0x5b, 0x22, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x73, 0x22, 0x5d, 0x5b, 0x6a, 0x5d, 
+0x5b, 0x69, 0x5d, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x69, 0x66, 0x28, 0x76, 0x20, 0x21, 0x3d, 
+0x3d, 0x20, 0x6e, 0x75, 0x6c, 0x6c, 0x29, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x6c, 0x6f, 
+0x77, 0x20, 0x3d, 0x20, 0x6c, 0x6f, 0x77, 0x20, 0x3d, 0x3d, 0x3d, 0x20, 0x6e, 0x75, 0x6c, 0x6c, 
+0x3f, 0x20, 0x76, 0x3a, 0x20, 0x4d, 0x61, 0x74, 0x68, 0x2e, 0x6d, 0x69, 0x6e, 0x28, 0x6c, 0x6f, 
+0x77, 0x2c, 0x20, 0x76, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x68, 0x69, 0x67, 0x68, 
+0x20, 0x3d, 0x20, 0x68, 0x69, 0x67, 0x68, 0x20, 0x3d, 0x3d, 0x3d, 0x20, 0x6e, 0x75, 0x6c, 0x6c, 
+0x3f, 0x20, 0x76, 0x3a, 0x20, 0x4d, 0x61, 0x74, 0x68, 0x2e, 0x6d, 0x61, 0x78, 0x28, 0x68, 0x69, 
+0x67, 0x68, 0x2c, 0x20, 0x76, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x09, 
+0x09, 0x7d, 0x0a, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x09, 0x62, 0x6f, 0x64, 0x79, 0x2e, 0x61, 0x70, 
+0x70, 0x65, 0x6e, 0x64, 0x28, 0x22, 0x3c, 0x68, 0x31, 0x3e, 0x47, 0x72, 0x69, 0x64, 0x20, 0x22, 
+0x20, 0x2b, 0x20, 0x67, 0x72, 0x69, 0x64, 0x20, 0x2b, 0x20, 0x22, 0x3c, 0x2f, 0x68, 0x31, 0x3e, 
+0x5c, 0x6e, 0x22, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x76, 0x61, 0x72, 0x20, 0x74, 0x61, 0x62, 0x6c, 
+0x65, 0x20, 0x3d, 0x20, 0x27, 0x3c, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x62, 0x6f, 0x72, 0x64, 
+0x65, 0x72, 0x3d, 0x22, 0x31, 0x22, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x73, 0x70, 0x61, 0x63, 0x69, 
+0x6e, 0x67, 0x3d, 0x22, 0x30, 0x22, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x70, 0x61, 0x64, 0x64, 0x69, 
+0x6e, 0x67, 0x3d, 0x22, 0x33, 0x22, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3d, 0x22, 0x66, 0x6f, 
+0x6e, 0x74, 0x2d, 0x73, 0x69, 0x7a, 0x65, 0x3a, 0x78, 0x2d, 0x73, 0x6d, 0x61, 0x6c, 0x6c, 0x22, 
+0x3e, 0x3c, 0x74, 0x72, 0x3e, 0x3c, 0x74, 0x68, 0x3e, 0x27, 0x20, 0x2b, 0x20, 0x67, 0x5b, 0x22, 
+0x79, 0x22, 0x5d, 0x20, 0x2b, 0x20, 0x27, 0x20, 0x5c, 0x5c, 0x20, 0x27, 0x20, 0x2b, 0x20, 0x67, 
+0x5b, 0x22, 0x78, 0x22, 0x5d, 0x20, 0x2b, 0x20, 0x27, 0x3c, 0x2f, 0x74, 0x68, 0x3e, 0x27, 0x3b, 
+0x0a, 0x09, 0x09, 0x66, 0x6f, 0x72, 0x28, 0x76, 0x61, 0x72, 0x20, 0x69, 0x3d, 0x30, 0x3b, 0x20, 
+0x69, 0x20, 0x3c, 0x20, 0x67, 0x5b, 0x22, 0x78, 0x73, 0x22, 0x5d, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 
+0x74, 0x68, 0x3b, 0x20, 0x2b, 0x2b, 0x69, 0x29, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x74, 0x61, 0x62, 
+0x6c, 0x65, 0x20, 0x2b, 0x3d, 0x20, 0x27, 0x3c, 0x74, 0x68, 0x3e, 0x27, 0x20, 0x2b, 0x20, 0x67, 
+0x5b, 0x22, 0x78, 0x73, 0x22, 0x5d, 0x5b, 0x69, 0x5d, 0x20, 0x2b, 0x20, 0x27, 0x3c, 0x2f, 0x74, 
+0x68, 0x3e, 0x27, 0x3b, 0x0a, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x09, 0x74, 0x61, 0x62, 0x6c, 0x65, 
+0x20, 0x2b, 0x3d, 0x20, 0x27, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0x27, 0x3b, 0x0a, 0x09, 0x09, 0x66, 
+0x6f, 0x72, 0x28, 0x76, 0x61, 0x72, 0x20, 0x6a, 0x3d, 0x30, 0x3b, 0x20, 0x6a, 0x20, 0x3c, 0x20, 
+0x67, 0x5b, 0x22, 0x79, 0x73, 0x22, 0x5d, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3b, 0x20, 
+0x2b, 0x2b, 0x6a, 0x29, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x2b, 
+0x3d, 0x20, 0x27, 0x3c, 0x74, 0x72, 0x3e, 0x3c, 0x74, 0x68, 0x3e, 0x27, 0x20, 0x2b, 0x20, 0x67, 
+0x5b, 0x22, 0x79, 0x73, 0x22, 0x5d, 0x5b, 0x6a, 0x5d, 0x20, 0x2b, 0x20, 0x27, 0x3c, 0x2f, 0x74, 
+0x68, 0x3e, 0x27, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x66, 0x6f, 0x72, 0x28, 0x76, 0x61, 0x72, 0x20, 
+0x69, 0x3d, 0x30, 0x3b, 0x20, 0x69, 0x20, 0x3c, 0x20, 0x67, 0x5b, 0x22, 0x78, 0x73, 0x22, 0x5d, 
+0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3b, 0x20, 0x2b, 0x2b, 0x69, 0x29, 0x7b, 0x0a, 0x09, 
+0x09, 0x09, 0x09, 0x76, 0x61, 0x72, 0x20, 0x76, 0x20, 0x3d, 0x20, 0x67, 0x5b, 0x22, 0x76, 0x61, 
+0x6c, 0x75, 0x65, 0x73, 0x22, 0x5d, 0x5b, 0x6a, 0x5d, 0x5b, 0x69, 0x5d, 0x3b, 0x0a, 0x09, 0x09, 
+0x09, 0x09, 0x69, 0x66, 0x28, 0x76, 0x20, 0x3d, 0x3d, 0x3d, 0x20, 0x6e, 0x75, 0x6c, 0x6c, 0x29, 
+0x7b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x2b, 0x3d, 0x20, 
+0x27, 0x3c, 0x74, 0x64, 0x3e, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x27, 0x3b, 0x0a, 0x09, 0x09, 0x09, 
+0x09, 0x09, 0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x75, 0x65, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 
+0x7d, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x76, 0x61, 0x72, 0x20, 0x74, 0x20, 0x3d, 0x20, 0x68, 0x69, 
+0x67, 0x68, 0x20, 0x3e, 0x20, 0x6c, 0x6f, 0x77, 0x3f, 0x20, 0x28, 0x76, 0x20, 0x2d, 0x20, 0x6c, 
+0x6f, 0x77, 0x29, 0x20, 0x2f, 0x20, 0x28, 0x68, 0x69, 0x67, 0x68, 0x20, 0x2d, 0x20, 0x6c, 0x6f, 
+0x77, 0x29, 0x3a, 0x20, 0x30, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x76, 0x61, 0x72, 0x20, 0x63, 
+0x6f, 0x6c, 0x6f, 0x72, 0x20, 0x3d, 0x20, 0x27, 0x72, 0x67, 0x62, 0x28, 0x27, 0x20, 0x2b, 0x20, 
+0x4d, 0x61, 0x74, 0x68, 0x2e, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x28, 0x32, 0x35, 0x35, 0x20, 0x2a, 
+0x20, 0x74, 0x29, 0x20, 0x2b, 0x20, 0x27, 0x2c, 0x27, 0x20, 0x2b, 0x20, 0x4d, 0x61, 0x74, 0x68, 
+0x2e, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x28, 0x32, 0x30, 0x30, 0x20, 0x2a, 0x20, 0x28, 0x31, 0x20, 
+0x2d, 0x20, 0x74, 0x29, 0x29, 0x20, 0x2b, 0x20, 0x27, 0x2c, 0x38, 0x30, 0x29, 0x27, 0x3b, 0x0a, 
+0x09, 0x09, 0x09, 0x09, 0x76, 0x61, 0x72, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x20, 0x3d, 0x20, 
+0x27, 0x62, 0x61, 0x63, 0x6b, 0x67, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x2d, 0x63, 0x6f, 0x6c, 0x6f, 
+0x72, 0x3a, 0x27, 0x20, 0x2b, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x20, 0x2b, 0x20, 0x28, 0x67, 
+0x5b, 0x22, 0x62, 0x65, 0x73, 0x74, 0x22, 0x5d, 0x5b, 0x69, 0x5d, 0x20, 0x3d, 0x3d, 0x3d, 0x20, 
+0x67, 0x5b, 0x22, 0x79, 0x73, 0x22, 0x5d, 0x5b, 0x6a, 0x5d, 0x3f, 0x20, 0x27, 0x3b, 0x66, 0x6f, 
+0x6e, 0x74, 0x2d, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3a, 0x62, 0x6f, 0x6c, 0x64, 0x27, 0x3a, 
+0x20, 0x27, 0x27, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 
+0x2b, 0x3d, 0x20, 0x27, 0x3c, 0x74, 0x64, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x3d, 0x22, 0x27, 
+0x20, 0x2b, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x20, 0x2b, 0x20, 0x27, 0x22, 0x3e, 0x27, 0x20, 
+0x2b, 0x20, 0x76, 0x20, 0x2b, 0x20, 0x27, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x27, 0x3b, 0x0a, 0x09, 
+0x09, 0x09, 0x7d, 0x0a, 0x09, 0x09, 0x09, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x2b, 0x3d, 0x20, 
+0x27, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0x27, 0x3b, 0x0a, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x09, 0x74, 
+0x61, 0x62, 0x6c, 0x65, 0x20, 0x2b, 0x3d, 0x20, 0x27, 0x3c, 0x74, 0x72, 0x3e, 0x3c, 0x74, 0x68, 
+0x3e, 0x62, 0x65, 0x73, 0x74, 0x20, 0x27, 0x20, 0x2b, 0x20, 0x67, 0x5b, 0x22, 0x79, 0x22, 0x5d, 
+0x20, 0x2b, 0x20, 0x27, 0x3c, 0x2f, 0x74, 0x68, 0x3e, 0x27, 0x3b, 0x0a, 0x09, 0x09, 0x66, 0x6f, 
+0x72, 0x28, 0x76, 0x61, 0x72, 0x20, 0x69, 0x3d, 0x30, 0x3b, 0x20, 0x69, 0x20, 0x3c, 0x20, 0x67, 
+0x5b, 0x22, 0x78, 0x73, 0x22, 0x5d, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3b, 0x20, 0x2b, 
+0x2b, 0x69, 0x29, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x2b, 0x3d, 
+0x20, 0x27, 0x3c, 0x74, 0x64, 0x3e, 0x27, 0x20, 0x2b, 0x20, 0x28, 0x67, 0x5b, 0x22, 0x62, 0x65, 
+0x73, 0x74, 0x22, 0x5d, 0x5b, 0x69, 0x5d, 0x20, 0x3d, 0x3d, 0x3d, 0x20, 0x6e, 0x75, 0x6c, 0x6c, 
+0x3f, 0x20, 0x27, 0x27, 0x3a, 0x20, 0x67, 0x5b, 0x22, 0x62, 0x65, 0x73, 0x74, 0x22, 0x5d, 0x5b, 
+0x69, 0x5d, 0x29, 0x20, 0x2b, 0x20, 0x27, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x27, 0x3b, 0x0a, 0x09, 
+0x09, 0x7d, 0x0a, 0x09, 0x09, 0x62, 0x6f, 0x64, 0x79, 0x2e, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 
+0x28, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x2b, 0x20, 0x27, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0x3c, 
+0x2f, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x27, 0x29, 0x3b, 0x0a, 0x09, 0x7d, 0x0a, 0x09, 0x0a, 
+0x09, 0x2f, 0x2f, 0x74, 0x68, 0x65, 0x20, 0x67, 0x72, 0x6f, 0x77, 0x74, 0x68, 0x20, 0x6d, 0x6f, 
+0x64, 0x65, 0x6c, 0x20, 0x66, 0x69, 0x74, 0x74, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x65, 0x76, 
+0x65, 0x72, 0x79, 0x20, 0x73, 0x65, 0x72, 0x69, 0x65, 0x73, 0x2c, 0x20, 0x61, 0x6e, 0x64, 0x20, 
+0x77, 0x68, 0x65, 0x72, 0x65, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6d, 0x65, 0x6d, 0x62, 0x65, 0x72, 
+0x73, 0x20, 0x6f, 0x66, 0x20, 0x61, 0x20, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x20, 0x63, 0x72, 0x6f, 
+0x73, 0x73, 0x0a, 0x09, 0x69, 0x66, 0x28, 0x64, 0x61, 0x74, 0x61, 0x5b, 0x22, 0x66, 0x69, 0x74, 
+0x73, 0x22, 0x5d, 0x20, 0x26, 0x26, 0x20, 0x4f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x2e, 0x6b, 0x65, 
+0x79, 0x73, 0x28, 0x64, 0x61, 0x74, 0x61, 0x5b, 0x22, 0x66, 0x69, 0x74, 0x73, 0x22, 0x5d, 0x29, 
+0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x20, 0x3e, 0x20, 0x30, 0x29, 0x7b, 0x0a, 0x09, 0x09, 
+0x62, 0x6f, 0x64, 0x79, 0x2e, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x28, 0x22, 0x3c, 0x68, 0x31, 
+0x3e, 0x43, 0x6f, 0x6d, 0x70, 0x6c, 0x65, 0x78, 0x69, 0x74, 0x79, 0x3c, 0x2f, 0x68, 0x31, 0x3e, 
+0x5c, 0x6e, 0x22, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x76, 0x61, 0x72, 0x20, 0x74, 0x61, 0x62, 0x6c, 
+0x65, 0x20, 0x3d, 0x20, 0x27, 0x3c, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x62, 0x6f, 0x72, 0x64, 
+0x65, 0x72, 0x3d, 0x22, 0x31, 0x22, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x73, 0x70, 0x61, 0x63, 0x69, 
+0x6e, 0x67, 0x3d, 0x22, 0x30, 0x22, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x70, 0x61, 0x64, 0x64, 0x69, 
+0x6e, 0x67, 0x3d, 0x22, 0x34, 0x22, 0x3e, 0x27, 0x3b, 0x0a, 0x09, 0x09, 0x74, 0x61, 0x62, 0x6c, 
+0x65, 0x20, 0x2b, 0x3d, 0x20, 0x27, 0x3c, 0x74, 0x72, 0x3e, 0x3c, 0x74, 0x68, 0x3e, 0x53, 0x65, 
+0x72, 0x69, 0x65, 0x73, 0x3c, 0x2f, 0x74, 0x68, 0x3e, 0x3c, 0x74, 0x68, 0x3e, 0x4d, 0x6f, 0x64, 
+0x65, 0x6c, 0x3c, 0x2f, 0x74, 0x68, 0x3e, 0x3c, 0x74, 0x68, 0x3e, 0x61, 0x3c, 0x2f, 0x74, 0x68, 
+0x3e, 0x3c, 0x74, 0x68, 0x3e, 0x62, 0x3c, 0x2f, 0x74, 0x68, 0x3e, 0x3c, 0x74, 0x68, 0x3e, 0x52, 
+0x65, 0x6c, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x72, 0x65, 0x73, 0x69, 0x64, 0x75, 0x61, 0x6c, 
+0x3c, 0x2f, 0x74, 0x68, 0x3e, 0x3c, 0x74, 0x68, 0x3e, 0x53, 0x69, 0x7a, 0x65, 0x73, 0x3c, 0x2f, 
+0x74, 0x68, 0x3e, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0x27, 0x3b, 0x0a, 0x09, 0x09, 0x66, 0x6f, 0x72, 
+0x28, 0x76, 0x61, 0x72, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x69, 0x6e, 0x20, 0x64, 0x61, 0x74, 
+0x61, 0x5b, 0x22, 0x66, 0x69, 0x74, 0x73, 0x22, 0x5d, 0x29, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x76, 
+0x61, 0x72, 0x20, 0x66, 0x69, 0x74, 0x20, 0x3d, 0x20, 0x64, 0x61, 0x74, 0x61, 0x5b, 0x22, 0x66, 
+0x69, 0x74, 0x73, 0x22, 0x5d, 0x5b, 0x6e, 0x61, 0x6d, 0x65, 0x5d, 0x3b, 0x0a, 0x09, 0x09, 0x09, 
+0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x2b, 0x3d, 0x20, 0x27, 0x3c, 0x74, 0x72, 0x3e, 0x3c, 0x74, 
+0x64, 0x3e, 0x27, 0x20, 0x2b, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x20, 0x2b, 0x20, 0x27, 0x3c, 0x2f, 
+0x74, 0x64, 0x3e, 0x3c, 0x74, 0x64, 0x3e, 0x27, 0x20, 0x2b, 0x20, 0x66, 0x69, 0x74, 0x5b, 0x22, 
+0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x22, 0x5d, 0x20, 0x2b, 0x20, 0x27, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 
+0x3c, 0x74, 0x64, 0x3e, 0x27, 0x20, 0x2b, 0x20, 0x66, 0x69, 0x74, 0x5b, 0x22, 0x61, 0x22, 0x5d, 
+0x20, 0x2b, 0x20, 0x27, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 0x74, 0x64, 0x3e, 0x27, 0x20, 0x2b, 
+0x20, 0x66, 0x69, 0x74, 0x5b, 0x22, 0x62, 0x22, 0x5d, 0x20, 0x2b, 0x0a, 0x09, 0x09, 0x09, 0x09, 
+0x27, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 0x74, 0x64, 0x3e, 0x27, 0x20, 0x2b, 0x20, 0x66, 0x69, 
+0x74, 0x5b, 0x22, 0x72, 0x65, 0x73, 0x69, 0x64, 0x75, 0x61, 0x6c, 0x22, 0x5d, 0x20, 0x2b, 0x20, 
+0x27, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 0x74, 0x64, 0x3e, 0x27, 0x20, 0x2b, 0x20, 0x66, 0x69, 
+0x74, 0x5b, 0x22, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x22, 0x5d, 0x20, 0x2b, 0x20, 0x27, 0x3c, 
+0x2f, 0x74, 0x64, 0x3e, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0x27, 0x3b, 0x0a, 0x09, 0x09, 0x7d, 0x0a, 
+0x09, 0x09, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x2b, 0x3d, 0x20, 0x27, 0x3c, 0x2f, 0x74, 0x61, 
+0x62, 0x6c, 0x65, 0x3e, 0x27, 0x3b, 0x0a, 0x09, 0x09, 0x62, 0x6f, 0x64, 0x79, 0x2e, 0x61, 0x70, 
+0x70, 0x65, 0x6e, 0x64, 0x28, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x29, 0x3b, 0x0a, 0x09, 0x7d, 0x0a, 
+0x09, 0x76, 0x61, 0x72, 0x20, 0x63, 0x72, 0x6f, 0x73, 0x73, 0x6f, 0x76, 0x65, 0x72, 0x73, 0x20, 
+0x3d, 0x20, 0x27, 0x27, 0x3b, 0x0a, 0x09, 0x66, 0x6f, 0x72, 0x28, 0x76, 0x61, 0x72, 0x20, 0x67, 
+0x72, 0x6f, 0x75, 0x70, 0x20, 0x69, 0x6e, 0x20, 0x64, 0x61, 0x74, 0x61, 0x5b, 0x22, 0x63, 0x72, 
+0x6f, 0x73, 0x73, 0x6f, 0x76, 0x65, 0x72, 0x73, 0x22, 0x5d, 0x29, 0x7b, 0x0a, 0x09, 0x09, 0x76, 
+0x61, 0x72, 0x20, 0x63, 0x72, 0x6f, 0x73, 0x73, 0x69, 0x6e, 0x67, 0x73, 0x20, 0x3d, 0x20, 0x64, 
+0x61, 0x74, 0x61, 0x5b, 0x22, 0x63, 0x72, 0x6f, 0x73, 0x73, 0x6f, 0x76, 0x65, 0x72, 0x73, 0x22, 
+0x5d, 0x5b, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x5d, 0x3b, 0x0a, 0x09, 0x09, 0x66, 0x6f, 0x72, 0x28, 
+0x76, 0x61, 0x72, 0x20, 0x69, 0x3d, 0x30, 0x3b, 0x20, 0x69, 0x20, 0x3c, 0x20, 0x63, 0x72, 0x6f, 
+0x73, 0x73, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3b, 0x20, 0x2b, 
+0x2b, 0x69, 0x29, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x63, 0x72, 0x6f, 0x73, 0x73, 0x6f, 0x76, 0x65, 
+0x72, 0x73, 0x20, 0x2b, 0x3d, 0x20, 0x27, 0x3c, 0x74, 0x72, 0x3e, 0x3c, 0x74, 0x64, 0x3e, 0x27, 
+0x20, 0x2b, 0x20, 0x67, 0x72, 0x6f, 0x75, 0x70, 0x20, 0x2b, 0x20, 0x27, 0x3c, 0x2f, 0x74, 0x64, 
+0x3e, 0x3c, 0x74, 0x64, 0x3e, 0x27, 0x20, 0x2b, 0x20, 0x63, 0x72, 0x6f, 0x73, 0x73, 0x69, 0x6e, 
+0x67, 0x73, 0x5b, 0x69, 0x5d, 0x5b, 0x30, 0x5d, 0x20, 0x2b, 0x20, 0x27, 0x3c, 0x2f, 0x74, 0x64, 
+0x3e, 0x3c, 0x74, 0x64, 0x3e, 0x27, 0x20, 0x2b, 0x20, 0x63, 0x72, 0x6f, 0x73, 0x73, 0x69, 0x6e, 
+0x67, 0x73, 0x5b, 0x69, 0x5d, 0x5b, 0x31, 0x5d, 0x20, 0x2b, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x27, 
+0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 0x74, 0x64, 0x3e, 0x27, 0x20, 0x2b, 0x20, 0x63, 0x72, 0x6f, 
+0x73, 0x73, 0x69, 0x6e, 0x67, 0x73, 0x5b, 0x69, 0x5d, 0x5b, 0x32, 0x5d, 0x20, 0x2b, 0x20, 0x27, 
+0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0x27, 0x3b, 0x0a, 0x09, 0x09, 0x7d, 
+0x0a, 0x09, 0x7d, 0x0a, 0x09, 0x69, 0x66, 0x28, 0x63, 0x72, 0x6f, 0x73, 0x73, 0x6f, 0x76, 0x65, 
+0x72, 0x73, 0x20, 0x21, 0x3d, 0x20, 0x27, 0x27, 0x29, 0x7b, 0x0a, 0x09, 0x09, 0x62, 0x6f, 0x64, 
+0x79, 0x2e, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 0x28, 0x22, 0x3c, 0x68, 0x31, 0x3e, 0x43, 0x72, 
+0x6f, 0x73, 0x73, 0x6f, 0x76, 0x65, 0x72, 0x73, 0x3c, 0x2f, 0x68, 0x31, 0x3e, 0x5c, 0x6e, 0x22, 
+0x29, 0x3b, 0x0a, 0x09, 0x09, 0x62, 0x6f, 0x64, 0x79, 0x2e, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 
+0x28, 0x27, 0x3c, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 0x72, 0x3d, 
+0x22, 0x31, 0x22, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x73, 0x70, 0x61, 0x63, 0x69, 0x6e, 0x67, 0x3d, 
+0x22, 0x30, 0x22, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 0x67, 0x3d, 
+0x22, 0x34, 0x22, 0x3e, 0x3c, 0x74, 0x72, 0x3e, 0x3c, 0x74, 0x68, 0x3e, 0x47, 0x72, 0x6f, 0x75, 
+0x70, 0x3c, 0x2f, 0x74, 0x68, 0x3e, 0x3c, 0x74, 0x68, 0x3e, 0x53, 0x65, 0x72, 0x69, 0x65, 0x73, 
+0x3c, 0x2f, 0x74, 0x68, 0x3e, 0x3c, 0x74, 0x68, 0x3e, 0x53, 0x65, 0x72, 0x69, 0x65, 0x73, 0x3c, 
+0x2f, 0x74, 0x68, 0x3e, 0x3c, 0x74, 0x68, 0x3e, 0x53, 0x69, 0x7a, 0x65, 0x3c, 0x2f, 0x74, 0x68, 
+0x3e, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0x27, 0x20, 0x2b, 0x0a, 0x09, 0x09, 0x09, 0x63, 0x72, 0x6f, 
+0x73, 0x73, 0x6f, 0x76, 0x65, 0x72, 0x73, 0x20, 0x2b, 0x20, 0x27, 0x3c, 0x2f, 0x74, 0x61, 0x62, 
+0x6c, 0x65, 0x3e, 0x27, 0x29, 0x3b, 0x0a, 0x09, 0x7d, 0x0a, 0x09, 0x69, 0x66, 0x28, 0x64, 0x61, 
+0x74, 0x61, 0x5b, 0x22, 0x65, 0x6e, 0x76, 0x69, 0x72, 0x6f, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x22, 
+0x5d, 0x20, 0x26, 0x26, 0x20, 0x4f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x2e, 0x6b, 0x65, 0x79, 0x73, 
+0x28, 0x64, 0x61, 0x74, 0x61, 0x5b, 0x22, 0x65, 0x6e, 0x76, 0x69, 0x72, 0x6f, 0x6e, 0x6d, 0x65, 
+0x6e, 0x74, 0x22, 0x5d, 0x29, 0x2e, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x20, 0x3e, 0x20, 0x30, 
+0x29, 0x7b, 0x0a, 0x09, 0x09, 0x62, 0x6f, 0x64, 0x79, 0x2e, 0x61, 0x70, 0x70, 0x65, 0x6e, 0x64, 
+0x28, 0x22, 0x3c, 0x68, 0x31, 0x3e, 0x45, 0x6e, 0x76, 0x69, 0x72, 0x6f, 0x6e, 0x6d, 0x65, 0x6e, 
+0x74, 0x3c, 0x2f, 0x68, 0x31, 0x3e, 0x5c, 0x6e, 0x22, 0x29, 0x3b, 0x0a, 0x09, 0x09, 0x76, 0x61, 
+0x72, 0x20, 0x72, 0x6f, 0x77, 0x73, 0x20, 0x3d, 0x20, 0x27, 0x27, 0x3b, 0x0a, 0x09, 0x09, 0x66, 
+0x6f, 0x72, 0x28, 0x76, 0x61, 0x72, 0x20, 0x6b, 0x65, 0x79, 0x20, 0x69, 0x6e, 0x20, 0x64, 0x61, 
+0x74, 0x61, 0x5b, 0x22, 0x65, 0x6e, 0x76, 0x69, 0x72, 0x6f, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x22, 
+0x5d, 0x29, 0x7b, 0x0a, 0x09, 0x09, 0x09, 0x76, 0x61, 0x72, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 
+0x20, 0x3d, 0x20, 0x53, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x28, 0x64, 0x61, 0x74, 0x61, 0x5b, 0x22, 
+0x65, 0x6e, 0x76, 0x69, 0x72, 0x6f, 0x6e, 0x6d, 0x65, 0x6e, 0x74, 0x22, 0x5d, 0x5b, 0x6b, 0x65, 
+0x79, 0x5d, 0x29, 0x2e, 0x72, 0x65, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x28, 0x2f, 0x26, 0x2f, 0x67, 
+0x2c, 0x20, 0x27, 0x26, 0x61, 0x6d, 0x70, 0x3b, 0x27, 0x29, 0x2e, 0x72, 0x65, 0x70, 0x6c, 0x61, 
+0x63, 0x65, 0x28, 0x2f, 0x3c, 0x2f, 0x67, 0x2c, 0x20, 0x27, 0x26, 0x6c, 0x74, 0x3b, 0x27, 0x29, 
+0x3b, 0x0a, 0x09, 0x09, 0x09, 0x72, 0x6f, 0x77, 0x73, 0x20, 0x2b, 0x3d, 0x20, 0x27, 0x3c, 0x74, 
+0x72, 0x3e, 0x3c, 0x74, 0x68, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x3d, 0x22, 0x6c, 0x65, 0x66, 
+0x74, 0x22, 0x3e, 0x27, 0x20, 0x2b, 0x20, 0x6b, 0x65, 0x79, 0x20, 0x2b, 0x20, 0x27, 0x3c, 0x2f, 
+0x74, 0x68, 0x3e, 0x3c, 0x74, 0x64, 0x3e, 0x27, 0x20, 0x2b, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 
+0x20, 0x2b, 0x20, 0x27, 0x3c, 0x2f, 0x74, 0x64, 0x3e, 0x3c, 0x2f, 0x74, 0x72, 0x3e, 0x27, 0x3b, 
+0x0a, 0x09, 0x09, 0x7d, 0x0a, 0x09, 0x09, 0x62, 0x6f, 0x64, 0x79, 0x2e, 0x61, 0x70, 0x70, 0x65, 
+0x6e, 0x64, 0x28, 0x27, 0x3c, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x62, 0x6f, 0x72, 0x64, 0x65, 
+0x72, 0x3d, 0x22, 0x31, 0x22, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x73, 0x70, 0x61, 0x63, 0x69, 0x6e, 
+0x67, 0x3d, 0x22, 0x30, 0x22, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6e, 
+0x67, 0x3d, 0x22, 0x34, 0x22, 0x3e, 0x27, 0x20, 0x2b, 0x20, 0x72, 0x6f, 0x77, 0x73, 0x20, 0x2b, 
+0x20, 0x27, 0x3c, 0x2f, 0x74, 0x61, 0x62, 0x6c, 0x65, 0x3e, 0x27, 0x29, 0x3b, 0x0a, 0x09, 0x7d, 
+0x0a, 0x7d, 0x29, 0x3b, 0x0a, 0x3c, 0x2f, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3e, 0x0a, 0x0a, 
+0x20, 0x3c, 0x2f, 0x62, 0x6f, 0x64, 0x79, 0x3e, 0x0a, 0x3c, 0x2f, 0x68, 0x74, 0x6d, 0x6c, 0x3e, 
+0x0a
+};
+};
+
+/**
+* xoshiro256** (Blackman and Vigna), a fast generator with a period of 2^256 - 1
+* jump() advances it by 2^128 steps, so the streams made by jumping do not overlap
+*/
+class RandomGenerator{
+	unsigned long long state[4];
+
+	static unsigned long long rotl(unsigned long long x, int k){
+		return (x << k) | (x >> (64 - k));
+	}
+public:
+	explicit RandomGenerator(unsigned long long seed = 0){
+		this->seed(seed);
+	}
+
+	/**
+	* fills the state with splitmix64, so close seeds give unrelated streams
+	*/
+	void seed(unsigned long long seed){
+		for(int i = 0; i < 4; ++i){
+			unsigned long long z = (seed += 0x9e3779b97f4a7c15ULL);
+			z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+			z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+			state[i] = z ^ (z >> 31);
+		}
+	}
+
+	unsigned long long next(){
+		unsigned long long result = rotl(state[1] * 5, 7) * 9;
+		unsigned long long t = state[1] << 17;
+		state[2] ^= state[0];
+		state[3] ^= state[1];
+		state[1] ^= state[2];
+		state[0] ^= state[3];
+		state[2] ^= t;
+		state[3] = rotl(state[3], 45);
+		return result;
+	}
+
+	/**
+	* returns a number in [0, bound), without the bias of a plain modulo
+	* bounds below 2^32 use a multiplication instead of a division (Lemire)
+	*/
+	unsigned long long below(unsigned long long bound){
+		if(bound <= 0xffffffffULL){
+			unsigned long long product = (next() >> 32) * bound;
+			if((unsigned int)product < bound){
+				unsigned int threshold = (0u - (unsigned int)bound) % (unsigned int)bound;
+				while((unsigned int)product < threshold){
+					product = (next() >> 32) * bound;
+				}
+			}
+			return product >> 32;
+		}
+		unsigned long long threshold = (0 - bound) % bound;
+		unsigned long long r;
+		do{
+			r = next();
+		}while(r < threshold);
+		return r % bound;
+	}
+
+	/**
+	* returns a number in [0, 1)
+	*/
+	double uniform(){
+		return (next() >> 11) * (1.0 / 9007199254740992.0);
+	}
+
+	void jump(){
+		static const unsigned long long JUMP[] = {
+			0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL, 0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL
+		};
+		unsigned long long jumped[4] = {0, 0, 0, 0};
+		for(int i = 0; i < 4; ++i){
+			for(int b = 0; b < 64; ++b){
+				if(JUMP[i] & (1ULL << b)){
+					for(int k = 0; k < 4; ++k){
+						jumped[k] ^= state[k];
+					}
+				}
+				next();
+			}
+		}
+		for(int k = 0; k < 4; ++k){
+			state[k] = jumped[k];
+		}
+	}
+};
+
+/**
+* the seed shared by the random streams of all threads; until SeedRandom is called it is
+* the current time, and rand() is seeded with it as well for the code which still uses it
+*/
+struct RandomSeeding{
+	std::atomic<unsigned long long> seed;
+	std::atomic<unsigned int> generation;
+	std::atomic<unsigned int> streams;
+
+	RandomSeeding() : seed((unsigned long long)time(NULL)), generation(0), streams(0) {
+		srand((unsigned int)seed);
+	}
+};
+
+inline RandomSeeding &randomSeeding(){
+	static RandomSeeding seeding;
+	return seeding;
+}
+
+struct RandomStream{
+	RandomGenerator generator;
+	unsigned int generation;
+	bool seeded;
+};
+
+inline RandomStream &threadRandomStream(){
+	static thread_local RandomStream stream = { RandomGenerator(), 0, false };
+	return stream;
+}
+
+/**
+* returns the random generator of the calling thread
+* the k-th thread to use it after SeedRandom gets the shared seed jumped k times, so the
+* threads draw from independent streams and a single thread always gets the same numbers
+*/
+inline RandomGenerator &ThreadRandom(){
+	RandomStream &stream = threadRandomStream();
+	RandomSeeding &seeding = randomSeeding();
+	unsigned int generation = seeding.generation;
+	if(!stream.seeded || stream.generation != generation){
+		stream.generator.seed(seeding.seed);
+		for(unsigned int k = seeding.streams++; k > 0; --k){
+			stream.generator.jump();
+		}
+		stream.generation = generation;
+		stream.seeded = true;
+	}
+	return stream.generator;
+}
+
+/**
+* seeds the random streams of all threads, the calling thread getting the first one
+*/
+inline void SeedRandom(unsigned long long seed){
+	RandomSeeding &seeding = randomSeeding();
+	seeding.seed = seed;
+	seeding.streams = 0;
+	++seeding.generation;
+	srand((unsigned int)seed);
+	ThreadRandom();
+}
+
+/**
+* seeds only the stream of the calling thread, until the next SeedRandom
+*/
+inline void SeedThreadRandom(unsigned long long seed){
+	RandomStream &stream = threadRandomStream();
+	stream.generator.seed(seed);
+	stream.generation = randomSeeding().generation;
+	stream.seeded = true;
+}
+
+/**
+* true while the calling thread runs a job of a sweep spread over several threads; the
+* array helpers then stay on the calling thread, since the sweep keeps every core busy
+*/
+inline bool &InParallelSweep(){
+	static thread_local bool inside = false;
+	return inside;
+}
+
+/**
+* a span recorded by TraceSpan: start and duration in nanoseconds since the first span
+*/
+struct TraceEvent{
+	const char *name;
+	unsigned long long start;
+	unsigned long long duration;
+};
+
+/**
+* the spans of one thread, in a ring which keeps the most recent ones
+*/
+struct TraceBuffer{
+	std::vector<TraceEvent> events;
+	size_t next;
+	bool wrapped;
+	int thread;
+
+	void record(const char *name, unsigned long long start, unsigned long long duration){
+		TraceEvent event = { name, start, duration };
+		events[next] = event;
+		if(++next == events.size()){
+			next = 0;
+			wrapped = true;
+		}
+	}
+};
+
+struct TraceRegistry{
+	std::mutex lock;
+	std::list<TraceBuffer> buffers;
+	size_t capacity;
+	std::chrono::steady_clock::time_point origin;
+
+	TraceRegistry() : capacity(1 << 16), origin(std::chrono::steady_clock::now()) {}
+};
+
+inline TraceRegistry &traceRegistry(){
+	static TraceRegistry registry;
+	return registry;
+}
+
+/**
+* the buffer of the calling thread, registered on first use and kept after the thread
+* ends, so the spans of joined threads can still be exported
+*/
+inline TraceBuffer &threadTraceBuffer(){
+	static thread_local TraceBuffer *buffer = NULL;
+	if(buffer == NULL){
+		TraceRegistry &registry = traceRegistry();
+		std::lock_guard<std::mutex> lock(registry.lock);
+		TraceBuffer created;
+		created.events.resize(registry.capacity);
+		created.next = 0;
+		created.wrapped = false;
+		created.thread = (int)registry.buffers.size() + 1;
+		registry.buffers.push_back(created);
+		buffer = &registry.buffers.back();
+	}
+	return *buffer;
+}
+
+inline unsigned long long traceClock(){
+	return (unsigned long long)std::chrono::duration_cast<std::chrono::nanoseconds>(
+		std::chrono::steady_clock::now() - traceRegistry().origin).count();
+}
+
+/**
+* records the time between its construction and its destruction under the given name,
+* which must still exist when the trace is exported (a string literal)
+* spans opened inside another one show up nested in the trace viewer
+*/
+class TraceSpan{
+	TraceBuffer &buffer;
+	const char *name;
+	unsigned long long start;
+public:
+	explicit TraceSpan(const char *name) : buffer(threadTraceBuffer()), name(name), start(traceClock()) {}
+
+	~TraceSpan(){
+		buffer.record(name, start, traceClock() - start);
+	}
+private:
+	TraceSpan(const TraceSpan&);
+	TraceSpan &operator=(const TraceSpan&);
 };
+
+/**
+* sets how many spans every thread keeps, for the threads which record their first span later
+*/
+inline void SetTraceCapacity(size_t spans){
+	TraceRegistry &registry = traceRegistry();
+	std::lock_guard<std::mutex> lock(registry.lock);
+	registry.capacity = (std::max)((size_t)1, spans);
+}
+
+/**
+* writes the spans of all threads as Chrome trace events, which chrome://tracing and
+* Perfetto open; the threads which record spans must have been joined
+* returns 0 on success, -1 if the file could not be written
+*/
+inline int ExportTrace(const char *fileName){
+	FILE *fout = NULL;
+#ifdef _MSC_VER
+	fopen_s(&fout, fileName, "wb");
+#else
+	fout = fopen(fileName, "wb");
+#endif
+	if(fout == NULL){
+		return -1;
+	}
+	TraceRegistry &registry = traceRegistry();
+	std::lock_guard<std::mutex> lock(registry.lock);
+	bool first = true;
+	fprintf(fout, "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [");
+	std::list<TraceBuffer>::const_iterator it;
+	for(it = registry.buffers.begin(); it != registry.buffers.end(); ++it){
+		size_t count = it->wrapped? it->events.size(): it->next;
+		size_t begin = it->wrapped? it->next: 0;
+		for(size_t i = 0; i < count; ++i){
+			const TraceEvent &event = it->events[(begin + i) % it->events.size()];
+			fprintf(fout, first? "\n{\"name\": \"": ",\n{\"name\": \"");
+			first = false;
+			for(const char *c = event.name; *c; ++c){
+				if(*c == '"' || *c == '\\'){
+					fputc('\\', fout);
+				}
+				fputc((unsigned char)*c < 0x20? ' ': *c, fout);
+			}
+			fprintf(fout, "\", \"ph\": \"X\", \"pid\": 1, \"tid\": %d, \"ts\": %.3f, \"dur\": %.3f}",
+				it->thread, event.start / 1000.0, event.duration / 1000.0);
+		}
+	}
+	fprintf(fout, "\n]}\n");
+	return fclose(fout) == 0? 0: -1;
+}
+
+/**
+* the size in bytes of the last level cache, or 32 MiB if it cannot be found
+*/
+inline size_t LastLevelCacheSize(){
+#if defined(__GLIBC__) && defined(_SC_LEVEL3_CACHE_SIZE)
+	long size = sysconf(_SC_LEVEL3_CACHE_SIZE);
+	if(size <= 0){
+		size = sysconf(_SC_LEVEL2_CACHE_SIZE);
+	}
+	if(size > 0){
+		return (size_t)size;
+	}
+#endif
+#ifdef __linux__
+	for(int index = 4; index >= 2; --index){
+		char path[96], unit = 'B';
+		unsigned long size = 0;
+		snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu0/cache/index%d/size", index);
+		FILE *fin = fopen(path, "r");
+		if(fin == NULL){
+			continue;
+		}
+		int fields = fscanf(fin, "%lu%c", &size, &unit);
+		fclose(fin);
+		if(fields >= 1 && size > 0){
+			return (size_t)size << (unit == 'K'? 10: unit == 'M'? 20: 0);
+		}
+	}
+#endif
+#ifdef _MSC_VER
+	DWORD length = 0;
+	GetLogicalProcessorInformation(NULL, &length);
+	std::vector<SYSTEM_LOGICAL_PROCESSOR_INFORMATION> info(length / sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION) + 1);
+	length = (DWORD)(info.size() * sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION));
+	if(GetLogicalProcessorInformation(&info[0], &length)){
+		size_t size = 0;
+		int level = 0;
+		for(size_t i = 0; i < length / sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION); ++i){
+			if(info[i].Relationship == RelationCache && info[i].Cache.Level >= level){
+				level = info[i].Cache.Level;
+				size = info[i].Cache.Size;
+			}
+		}
+		if(size > 0){
+			return size;
+		}
+	}
+#endif
+	return (size_t)32 << 20;
+}
+
+/**
+* evicts the data of the measured code from the caches, by writing a buffer as large as
+* the last level cache, one cache line at a time
+*/
+inline void FlushCaches(){
+	static std::vector<unsigned char> buffer(LastLevelCacheSize());
+	volatile unsigned char *data = &buffer[0];
+	for(size_t i = 0; i < buffer.size(); i += 64){
+		data[i] = (unsigned char)(data[i] + 1);
+	}
+}
+
+/**
+* the processors a thread was allowed to run on, before PinThread
+*/
+struct ThreadAffinity{
+#if defined(__linux__)
+	cpu_set_t mask;
+#elif defined(_MSC_VER)
+	DWORD_PTR mask;
+#endif
+	bool saved;
+
+	ThreadAffinity() : saved(false) {}
 };
 
+/**
+* restricts the calling thread to the given processor, so that it is not migrated between
+* cores in the middle of a measurement; remembers the previous affinity in previous
+* returns false if the platform does not allow it
+*/
+inline bool PinThread(int cpu, ThreadAffinity &previous){
+#if defined(__linux__)
+	cpu_set_t mask;
+	if(cpu < 0 || cpu >= CPU_SETSIZE || sched_getaffinity(0, sizeof(previous.mask), &previous.mask) != 0){
+		return false;
+	}
+	CPU_ZERO(&mask);
+	CPU_SET(cpu, &mask);
+	if(sched_setaffinity(0, sizeof(mask), &mask) != 0){
+		return false;
+	}
+	previous.saved = true;
+	return true;
+#elif defined(_MSC_VER)
+	if(cpu < 0 || cpu >= (int)(sizeof(DWORD_PTR) * 8)){
+		return false;
+	}
+	previous.mask = SetThreadAffinityMask(GetCurrentThread(), (DWORD_PTR)1 << cpu);
+	previous.saved = previous.mask != 0;
+	return previous.saved;
+#else
+	(void)cpu;
+	(void)previous;
+	return false;
+#endif
+}
+
+/**
+* lets the calling thread run where it did before PinThread
+*/
+inline void UnpinThread(ThreadAffinity &previous){
+	if(!previous.saved){
+		return;
+	}
+#if defined(__linux__)
+	sched_setaffinity(0, sizeof(previous.mask), &previous.mask);
+#elif defined(_MSC_VER)
+	SetThreadAffinityMask(GetCurrentThread(), previous.mask);
+#endif
+	previous.saved = false;
+}
+
+/**
+* the first line of a text file, without the line end, or an empty string
+*/
+inline std::string ReadFirstLine(const char *fileName, const char *prefix = NULL){
+	std::string result;
+	FILE *fin = fopen(fileName, "r");
+	if(fin == NULL){
+		return result;
+	}
+	char line[512];
+	size_t prefixLen = prefix? strlen(prefix): 0;
+	while(fgets(line, sizeof(line), fin) != NULL){
+		if(prefix == NULL || strncmp(line, prefix, prefixLen) == 0){
+			result = line + prefixLen;
+			break;
+		}
+	}
+	fclose(fin);
+	while(!result.empty() && (result[result.size() - 1] == '\n' || result[result.size() - 1] == '\r')){
+		result.erase(result.size() - 1);
+	}
+	return result;
+}
+
+/**
+* describes the machine and the build which produce the measurements, so that reports
+* from different runs can be told apart
+*/
+inline void CollectEnvironment(std::map<std::string, std::string> &environment){
+	char text[256];
+	time_t now = time(NULL);
+	strftime(text, sizeof(text), "%Y-%m-%d %H:%M:%S", localtime(&now));
+	environment["date"] = text;
+#if defined(__linux__)
+	std::string cpu = ReadFirstLine("/proc/cpuinfo", "model name");
+	size_t colon = cpu.find(": ");
+	environment["cpu"] = colon == std::string::npos? cpu: cpu.substr(colon + 2);
+	environment["frequency governor"] = ReadFirstLine("/sys/devices/system/cpu/cpu0/cpufreq/scaling_governor");
+#elif defined(_MSC_VER)
+	const char *cpu = getenv("PROCESSOR_IDENTIFIER");
+	environment["cpu"] = cpu? cpu: "";
+#endif
+	snprintf(text, sizeof(text), "%u", std::thread::hardware_concurrency());
+	environment["hardware threads"] = text;
+	snprintf(text, sizeof(text), "%zu KiB", LastLevelCacheSize() >> 10);
+	environment["last level cache"] = text;
+#ifdef _MSC_VER
+	environment["os"] = "Windows";
+	snprintf(text, sizeof(text), "MSVC %d", _MSC_FULL_VER);
+	environment["compiler"] = text;
+#else
+	struct utsname name;
+	if(uname(&name) == 0){
+		environment["os"] = std::string(name.sysname) + " " + name.release + " " + name.machine;
+	}
+#   if defined(__clang__)
+	environment["compiler"] = "clang " __clang_version__;
+#   elif defined(__GNUC__)
+	environment["compiler"] = "gcc " __VERSION__;
+#   endif
+#endif
+#ifdef NDEBUG
+	environment["build"] = "release";
+#else
+	environment["build"] = "debug, asserts enabled";
+#endif
+}
+
+#define PROFILER_CONCAT_(a, b) a##b
+#define PROFILER_CONCAT(a, b) PROFILER_CONCAT_(a, b)
+
+/**
+* TRACE_SPAN(name) opens a TraceSpan until the end of the enclosing block, when
+* PROFILER_TRACE is defined before including Profiler.h, and compiles to nothing otherwise
+*/
+#ifdef PROFILER_TRACE
+#   define TRACE_SPAN(name) TraceSpan PROFILER_CONCAT(traceSpan, __LINE__)(name)
+#else
+#   define TRACE_SPAN(name) ((void)0)
+#endif
+
 class Profiler{
 public:
 	/**
@@ -11100,33 +11970,136 @@ public:
 	*/
 	static const int MAX_NAME_LEN = 128;
 
+	/**
+	* handle of an interned series, see internSeries
+	*/
+	typedef int SeriesId;
+
+	/**
+	* the sizes which the values of a series are kept at; 64 bit, so that a sweep can go
+	* past 2^31 elements
+	*/
+	typedef long long SizeKey;
+
 	/**
 	* constructs a new profiler with the given title
 	*/
-	Profiler(const char* givenTitle = NULL){
+	Profiler(const char* givenTitle = NULL) : owner(std::this_thread::get_id()), costs(instrumentationOverhead()), journal(NULL), noiseWarmups(0), noiseColdCache(false) {
 		reset(givenTitle);
 	}
 
 	~Profiler(){
+		closeJournal();
+		UnpinThread(affinity);
 	}
 
     /**
     * increases the count for operation name, at the specified size
     */
     void reset(const char *newTitle = NULL){
-        if(opcountMap.size() != 0){
+        mergeShards();
+        if(!ownShard.empty()){
             showReport();
         }
         title = newTitle? newTitle: "Title";
         groups.clear();
-        opcountMap.clear();
+        for(int section = 0; section < SECTION_COUNT; ++section){
+            samples[section].clear();
+        }
+        ownShard = Shard();
+        threadShards.clear();
+        shards.clear();
+        siteSeries.clear();
+        grids.clear();
+        resetJournal();
     }
 
 	/**
 	* increases the count for operation name, at the specified size
 	*/
-	void countOperation(const char *name, int size, int increment=1){
-		opcountMap[name][size] += increment;
+#ifdef PROFILER_CALL_SITES
+	void countOperation(const char *name, SizeKey size, long long increment=1,
+						const char *file = __builtin_FILE(), int line = __builtin_LINE()){
+		countOperation(internSeries(name), size, increment, file, line);
+	}
+
+	void countOperation(SeriesId series, SizeKey size, long long increment=1,
+						const char *file = __builtin_FILE(), int line = __builtin_LINE()){
+		Shard &shard = crtShard();
+		addCount(shard, series, tableCell(shard.opcount, series, size), increment);
+		countSite(shard, series, size, file, line, increment);
+	}
+#else
+	void countOperation(const char *name, SizeKey size, long long increment=1){
+		countOperation(internSeries(name), size, increment);
+	}
+
+	void countOperation(SeriesId series, SizeKey size, long long increment=1){
+		Shard &shard = crtShard();
+		addCount(shard, series, tableCell(shard.opcount, series, size), increment);
+	}
+#endif
+
+	/**
+	* returns the handle of the series with the given name, registering the name on first use
+	* the handle stays valid after reset; counters created from it skip looking up the name
+	*/
+	SeriesId internSeries(const char *name){
+		std::lock_guard<std::mutex> lock(registryLock);
+		std::map<std::string, SeriesId>::iterator it = seriesIds.find(name);
+		if(it == seriesIds.end()){
+			it = seriesIds.insert(std::make_pair(std::string(name), (SeriesId)seriesIds.size())).first;
+			seriesNames.push_back(it->first);
+		}
+		return it->second;
+	}
+
+	/**
+	* starts measuring the execution time of timerName, at the specified size
+	* the measured time is added to the "times" section of the report, in nanoseconds
+	*/
+	void startTimer(const char *timerName, SizeKey size, int backend = STEADY_CLOCK){
+		startTimer(internSeries(timerName), size, backend);
+	}
+
+	void startTimer(SeriesId series, SizeKey size, int backend = STEADY_CLOCK){
+		Shard &shard = crtShard();
+		RunningTimer &timer = shard.runningTimers[series][size];
+		timer.backend = backend;
+		timer.corrected = &correctedCell(shard, series, size);
+		timer.startIncrements = shard.increments;
+		timer.startNested = shard.nestedOverhead;
+		timer.start = readTimestamp(backend);
+	}
+
+	/**
+	* adds nanoseconds measured without a timer to a series of the "times" section; the
+	* profiler added no overhead to them, so there is no _corrected series
+	*/
+	void addTime(const char *name, SizeKey size, unsigned long long nanoseconds){
+		tableCell(crtShard().times, internSeries(name), size) += nanoseconds;
+	}
+
+	/**
+	* stops the timer started with startTimer and adds the elapsed time to its series
+	*/
+	void stopTimer(const char *timerName, SizeKey size){
+		stopTimer(internSeries(timerName), size);
+	}
+
+	void stopTimer(SeriesId series, SizeKey size){
+		TIME_MEASURE stop;
+		Shard &shard = crtShard();
+		RunningTimerMap::iterator it = shard.runningTimers.find(series);
+		if(it == shard.runningTimers.end() || it->second.find(size) == it->second.end()){
+			return;
+		}
+		RunningTimer &timer = it->second[size];
+		stop = readTimestamp(timer.backend);
+		TIME_MEASURE elapsed = elapsedNanoseconds(timer.backend, timer.start, stop);
+		tableCell(shard.times, series, size) += elapsed;
+		*timer.corrected += correctTime(shard, timer.backend, elapsed, timer.startIncrements, timer.startNested);
+		it->second.erase(size);
 	}
 
 	/**
@@ -11159,195 +12132,3437 @@ public:
 	* creates a new series, by summing the given ones
 	*/
 	void addSeries(const char *newName, const char *series1, const char *series2){
-		if (opcountMap.find(series1) != opcountMap.end() &&
-			opcountMap.find(series2) != opcountMap.end()){
-				OpcountSequence::const_iterator it1, it2;
-				opcountMap[newName] = OpcountSequence();
-				for (it1 = opcountMap[series1].begin(); it1 != opcountMap[series1].end(); ++it1){
-					it2 = opcountMap[series2].find(it1->first);
-					if(it2 != opcountMap[series2].end()){
-						opcountMap[newName][it1->first] = it1->second + it2->second;
-					}else{
-						opcountMap[newName][it1->first] = it1->second;
-					}
-				}
-		}
+		SeriesId newId = internSeries(newName), id1 = internSeries(series1), id2 = internSeries(series2);
+		mergeShards();
+		sumSeries(ownShard.opcount, newId, id1, id2);
+		sumSeries(ownShard.times, newId, id1, id2);
+		sumSeries(ownShard.hardware, newId, id1, id2);
+		sumSeries(ownShard.memory, newId, id1, id2);
 	}
 
     /**
     * divides the values in a series
     */
 	void divideValues(const char *series, unsigned int divisor) {
-		if (opcountMap.find(series) != opcountMap.end() && divisor != 0) {
-			OpcountSequence::iterator it;
-			for (it = opcountMap[series].begin(); it != opcountMap[series].end(); ++it) {
-				it->second /= divisor;
-			}
+		SeriesId id = internSeries(series);
+		mergeShards();
+		divideSeries(ownShard.opcount, id, divisor);
+		divideSeries(ownShard.times, id, divisor);
+		divideSeries(ownShard.hardware, id, divisor);
+		divideSeries(ownShard.memory, id, divisor);
+		//and the corrected times of a timer along with its raw times
+		bool hasCorrected;
+		{
+			std::lock_guard<std::mutex> lock(registryLock);
+			hasCorrected = seriesIds.find(std::string(series) + "_corrected") != seriesIds.end();
+		}
+		if(hasCorrected){
+			divideSeries(ownShard.times, internSeries((std::string(series) + "_corrected").c_str()), divisor);
 		}
 	}
 
 	/**
-	* creates and shows the report
+	* a two dimensional sweep, such as (n, k) or (size, load factor): the value at (x, y) is
+	* kept at size x in the series <name>_<yLabel>_<y>, which gridSeries returns, so counters,
+	* timers, repeat and divideValues work on its rows as on any other series
+	* the report shows every grid as a heatmap with the y of the smallest value at each x,
+	* and the rows as a group; exportGrid writes it as a matrix
 	*/
-	int showReport(){
-		FILE *fout = NULL;
-		bool hasData, hasSequences;
-		char reportName[200];
-		time_t crtTime = time(0);
-		struct tm now;
-#ifdef _MSC_VER
-		localtime_s(&now, &crtTime);
-#else
-        now = *localtime(&crtTime);
-#endif
+	SeriesId gridSeries(const char *name, double y, const char *xLabel = "size", const char *yLabel = "y"){
+		char row[64];
+		snprintf(row, sizeof(row), "_%g", y);
+		SeriesId series = internSeries((std::string(name) + "_" + yLabel + row).c_str());
+		std::lock_guard<std::mutex> lock(registryLock);
+		Grid &grid = grids[name];
+		if(grid.rows.empty()){
+			grid.xLabel = xLabel;
+			grid.yLabel = yLabel;
+		}
+		grid.rows[y] = series;
+		return series;
+	}
 
-#ifdef _MSC_VER
-		_snprintf_s(
-#else
-        snprintf(
-#endif
-                            reportName, sizeof(reportName), 
-                            "report-%s-%04d%02d%02d-%02d%02d%02d.html", 
-							title.c_str(),
-							now.tm_year + 1900,
-							now.tm_mon + 1,
-							now.tm_mday,
-							now.tm_hour,
-							now.tm_min,
-							now.tm_sec
-		);
-#ifdef _MSC_VER
-		fopen_s(&fout, reportName, "wb");
-#else
-		fout = fopen(reportName, "wb");
-#endif
-		fwrite(HtmlGen::htmlFirst, 1, sizeof(HtmlGen::htmlFirst)/sizeof(HtmlGen::htmlFirst[0]), fout);
+	/**
+	* divides every row of a grid, see divideValues
+	*/
+	void divideGrid(const char *name, unsigned int divisor){
+		std::map<std::string, Grid>::const_iterator it = grids.find(name);
+		if(it == grids.end()){
+			return;
+		}
+		std::map<double, SeriesId>::const_iterator row;
+		for(row = it->second.rows.begin(); row != it->second.rows.end(); ++row){
+			divideValues(seriesName(row->second).c_str(), divisor);
+		}
+	}
 
-		//first, show the operation counters
-		fprintf(fout, "{\n\t\"opcount\": {\n");
-		OpcountMap::const_iterator oit1;
-		OpcountSequence::const_iterator oit2;
+	/**
+	* writes a grid as CSV, a row for every y and a column for every x, leaving out the
+	* points which were not measured
+	* returns 0 on success, -1 if there is no such grid or a write failed
+	*/
+	int exportGrid(FILE *fout, const char *name){
+		std::map<std::string, Grid>::const_iterator it = grids.find(name);
+		if(it == grids.end()){
+			return -1;
+		}
+		std::vector<SizeKey> xs;
+		std::vector<std::vector<double> > values;
+		gridMatrix(it->second, xs, values);
+		fprintf(fout, "%s\\%s", it->second.yLabel.c_str(), it->second.xLabel.c_str());
+		for(size_t i = 0; i < xs.size(); ++i){
+			fprintf(fout, ",%lld", xs[i]);
+		}
+		std::map<double, SeriesId>::const_iterator row = it->second.rows.begin();
+		for(size_t j = 0; j < values.size(); ++j, ++row){
+			fprintf(fout, "\n%g", row->first);
+			for(size_t i = 0; i < xs.size(); ++i){
+				fprintf(fout, isnan(values[j][i])? ",": ",%.15g", values[j][i]);
+			}
+		}
+		fprintf(fout, "\n");
+		return ferror(fout)? -1: 0;
+	}
+
+	/**
+	* what the instrumentation costs on this machine, in nanoseconds, measured once per program
+	* increment: one count() of an Operation
+	* scope: what a timer reports for an empty start()/stop(), for each TimerBackend
+	* nested: what a start()/stop() pair adds to a timer around it, for each TimerBackend
+	*/
+	struct Overhead{
+		double increment;
+		double scope[2];
+		double nested[2];
+	};
+
+	/**
+	* every timer also writes <name>_corrected, its time without the overhead of the counting
+	* and of the timers done while it ran, so that instrumented runs can be compared with
+	* uninstrumented ones; the overhead is calibrated when the first Profiler is created
+	* what the compiler could not optimize because of the counting is not part of it
+	*/
+	static const Overhead &instrumentationOverhead(){
+		static const Overhead measured = calibrateOverhead();
+		return measured;
+	}
+
+	/**
+	* summary of the samples of a series at one size
+	* ciLow and ciHigh bound the 95% confidence interval of the mean
+	*/
+	struct Statistics{
+		int samples;
+		double mean, median, min, max, p95, stddev;
+		double ciLow, ciHigh;
+	};
+
+	/**
+	* calls measure(repetition) for the given size at least minRepetitions and at most
+	* maxRepetitions times, keeping what each call added to a counter or timer at this size
+	* as a separate sample
+	* if maxRelativeError is positive, it stops once the confidence interval of every such
+	* series is narrower than mean * (1 +- maxRelativeError)
+	* afterwards the series hold the mean of their samples instead of the sum, so there
+	* is no need to call divideValues; returns the number of repetitions done
+	*/
+	template <typename F>
+	int repeat(SizeKey size, F measure, int minRepetitions = 5, int maxRepetitions = 5, double maxRelativeError = 0){
+		SampleSet sets[SECTION_COUNT];
+		int repetition = 0;
+		mergeShards();
+		while(repetition < maxRepetitions){
+			takeSnapshot(ownShard.opcount, size, sets[OPCOUNT_SECTION], repetition == 0);
+			takeSnapshot(ownShard.times, size, sets[TIMES_SECTION], repetition == 0);
+			takeSnapshot(ownShard.hardware, size, sets[HARDWARE_SECTION], repetition == 0);
+			takeSnapshot(ownShard.memory, size, sets[MEMORY_SECTION], repetition == 0);
+			if(!restorePoint(ownShard, size, repetition)){
+				PointSnapshot before;
+				takeJournalSnapshot(ownShard, size, before);
+				measure(repetition);
+				mergeShards();
+				commitPoint(ownShard, size, repetition, before);
+			}
+			collectSamples(ownShard.opcount, size, sets[OPCOUNT_SECTION], repetition);
+			collectSamples(ownShard.times, size, sets[TIMES_SECTION], repetition);
+			collectSamples(ownShard.hardware, size, sets[HARDWARE_SECTION], repetition);
+			collectSamples(ownShard.memory, size, sets[MEMORY_SECTION], repetition);
+			++repetition;
+			if(repetition >= minRepetitions && maxRelativeError > 0 &&
+				isPrecise(sets[OPCOUNT_SECTION], maxRelativeError) && isPrecise(sets[TIMES_SECTION], maxRelativeError) &&
+				isPrecise(sets[HARDWARE_SECTION], maxRelativeError) && isPrecise(sets[MEMORY_SECTION], maxRelativeError)){
+				break;
+			}
+		}
+		storeSamples(ownShard.opcount, size, sets[OPCOUNT_SECTION], samples[OPCOUNT_SECTION], repetition);
+		storeSamples(ownShard.times, size, sets[TIMES_SECTION], samples[TIMES_SECTION], repetition);
+		storeSamples(ownShard.hardware, size, sets[HARDWARE_SECTION], samples[HARDWARE_SECTION], repetition);
+		storeSamples(ownShard.memory, size, sets[MEMORY_SECTION], samples[MEMORY_SECTION], repetition);
+		return repetition;
+	}
+
+	/**
+	* one (size, repetition) measurement of a sweep
+	* seed is the same for a size and repetition on every run, whatever thread runs the job;
+	* the random stream of the thread is seeded with it and the SeedRandom seed before the job,
+	* so FillRandomArray gives every job the same input as a serial run would
+	* buffer(slot) gives size elements of a plain type, reused by the jobs of the same thread
+	*/
+	class SweepJob{
+		std::vector<std::vector<std::max_align_t> > &buffers;
+		friend class Profiler;
+		SweepJob(SizeKey size, int repetition, std::vector<std::vector<std::max_align_t> > &buffers)
+			: buffers(buffers), size(size), repetition(repetition),
+			seed(mix(mix((unsigned long long)size + 0x9e3779b97f4a7c15ULL) + (unsigned long long)repetition)) {}
+
+		/**
+		* the splitmix64 finalizer, so every bit of the size reaches the seed
+		*/
+		static unsigned long long mix(unsigned long long z){
+			z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+			z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+			return z ^ (z >> 31);
+		}
+	  public:
+		SizeKey size;
+		int repetition;
+		unsigned long long seed;
+
+		template <typename T>
+		T *buffer(int slot = 0) {
+			if(buffers.size() <= (size_t)slot){
+				buffers.resize(slot + 1);
+			}
+			size_t words = ((size_t)size * sizeof(T) + sizeof(std::max_align_t) - 1) / sizeof(std::max_align_t);
+			if(buffers[slot].size() < words){
+				buffers[slot].resize(words);
+			}
+			return reinterpret_cast<T*>(buffers[slot].data());
+		}
+	};
+
+	/**
+	* runs measure(job) for every size from minSize to maxSize, going up by step, and for
+	* every repetition below repetitions, on the given number of threads (0 for one per core)
+	* the counters created by a job go to the shard of its thread, and are merged when the
+	* report is built, so the operation counts are the same as those of the serial loop;
+	* the jobs of the biggest sizes are started first, to keep the threads busy until the end
+	* an exception thrown by a job stops the sweep and is thrown again here
+	* with an open journal, the jobs it already holds are not run again, and every finished
+	* job is added to it; a job should only count at its own size
+	*/
+	template <typename F>
+	void sweep(SizeKey minSize, SizeKey maxSize, SizeKey step, int repetitions, F measure, int threads = 0){
+		std::vector<std::pair<SizeKey, int> > jobs;
+		for(SizeKey size = minSize; size <= maxSize; size += step){
+			for(int repetition = 0; repetition < repetitions; ++repetition){
+				jobs.push_back(std::make_pair(size, repetition));
+			}
+		}
+		std::stable_sort(jobs.begin(), jobs.end(),
+			[](const std::pair<SizeKey, int> &a, const std::pair<SizeKey, int> &b){ return a.first > b.first; });
+		if(threads <= 0){
+			threads = (std::max)(1, (int)std::thread::hardware_concurrency());
+		}
+		threads = (std::min)(threads, (int)jobs.size());
+
+		std::atomic<size_t> next(0);
+		std::atomic<bool> failed(false);
+		std::exception_ptr error;
+		std::mutex errorLock;
+		auto work = [&](){
+			std::vector<std::vector<std::max_align_t> > buffers;
+			size_t i;
+			bool outer = InParallelSweep();
+			InParallelSweep() = outer || threads > 1;
+			while(!failed && (i = next++) < jobs.size()){
+				try{
+					SweepJob job(jobs[i].first, jobs[i].second, buffers);
+					Shard &shard = crtShard();
+					if(restorePoint(shard, job.size, job.repetition)){
+						continue;
+					}
+					PointSnapshot before;
+					takeJournalSnapshot(shard, job.size, before);
+					SeedThreadRandom(randomSeeding().seed ^ job.seed);
+					measure(job);
+					commitPoint(shard, job.size, job.repetition, before);
+				}catch(...){
+					std::lock_guard<std::mutex> lock(errorLock);
+					if(!failed){
+						error = std::current_exception();
+						failed = true;
+					}
+				}
+			}
+			InParallelSweep() = outer;
+		};
+		std::vector<std::thread> workers;
+		for(int t = 1; t < threads; ++t){
+			workers.push_back(std::thread(work));
+		}
+		work(); // the calling thread takes jobs as well
+		for(size_t t = 0; t < workers.size(); ++t){
+			workers[t].join();
+		}
+		if(error){
+			std::rethrow_exception(error);
+		}
+	}
+
+	/**
+	* calls measure(size) for sizes between minSize and maxSize chosen as it goes, until
+	* budgetSeconds of measuring are spent: first initialSizes sizes spaced geometrically,
+	* then, one at a time, the geometric middle of the interval where the series curve the
+	* most, or where two members of a group cross or move apart, weighted by how wide the
+	* interval is; if group names a group created before, only its members drive the choice
+	* a size is not started if the measurement of the size above it would not fit in the
+	* budget; returns the number of sizes measured
+	*/
+	template <typename F>
+	int adaptiveSweep(SizeKey minSize, SizeKey maxSize, double budgetSeconds, F measure, const char *group = NULL, int initialSizes = 12){
+		std::vector<SizeKey> sizes;
+		std::vector<double> seconds;
+		std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+		minSize = (std::max)((SizeKey)1, minSize);
+		initialSizes = (std::max)(2, initialSizes);
+		double ratio = pow((double)maxSize / minSize, 1.0 / (initialSizes - 1));
+		for(int i = 0; i < initialSizes && elapsedSeconds(begin) < budgetSeconds; ++i){
+			SizeKey size = i == initialSizes - 1? maxSize: (SizeKey)(minSize * pow(ratio, i) + 0.5);
+			if(size <= maxSize && std::find(sizes.begin(), sizes.end(), size) == sizes.end()){
+				measureAt(size, measure, sizes, seconds);
+			}
+		}
+		while(true){
+			int interval = refinedInterval(sizes, group);
+			if(interval < 0){
+				break;
+			}
+			SizeKey low = sizes[interval], high = sizes[interval + 1];
+			SizeKey size = (SizeKey)(sqrt((double)low * high) + 0.5);
+			size = (std::min)((std::max)(size, low + 1), high - 1);
+			if(elapsedSeconds(begin) + seconds[interval + 1] > budgetSeconds){
+				break;
+			}
+			measureAt(size, measure, sizes, seconds);
+		}
+		return (int)sizes.size();
+	}
+
+	/**
+	* returns the statistics of the samples recorded by repeat for a series at a size,
+	* looking at the operation counters first, then at the timers, hardware counters and allocations
+	*/
+	Statistics getStatistics(const char *series, SizeKey size){
+		SeriesId id = internSeries(series);
+		for(int section = 0; section < SECTION_COUNT; ++section){
+			SampleMap::iterator it = samples[section].find(id);
+			if(it != samples[section].end() && it->second.find(size) != it->second.end()){
+				return computeStatistics(it->second[size]);
+			}
+		}
+		return computeStatistics(std::vector<double>());
+	}
+
+	/**
+	* creates the series <series>_min, _median, _p95, _stddev, _ci_low and _ci_high
+	* from the samples recorded by repeat, the series itself holding the mean
+	*/
+	void addStatisticsSeries(const char *series){
+		std::string name = series;
+		SeriesId id = internSeries(series);
+		SeriesId minId = internSeries((name + "_min").c_str());
+		SeriesId medianId = internSeries((name + "_median").c_str());
+		SeriesId p95Id = internSeries((name + "_p95").c_str());
+		SeriesId stddevId = internSeries((name + "_stddev").c_str());
+		SeriesId ciLowId = internSeries((name + "_ci_low").c_str());
+		SeriesId ciHighId = internSeries((name + "_ci_high").c_str());
+		for(int section = 0; section < SECTION_COUNT; ++section){
+			SampleMap::iterator it = samples[section].find(id);
+			if(it == samples[section].end()){
+				continue;
+			}
+			std::map<SizeKey, std::vector<double> >::iterator sizeIt;
+			for(sizeIt = it->second.begin(); sizeIt != it->second.end(); ++sizeIt){
+				Statistics stats = computeStatistics(sizeIt->second);
+				setRounded(section, minId, sizeIt->first, stats.min);
+				setRounded(section, medianId, sizeIt->first, stats.median);
+				setRounded(section, p95Id, sizeIt->first, stats.p95);
+				setRounded(section, stddevId, sizeIt->first, stats.stddev);
+				setRounded(section, ciLowId, sizeIt->first, stats.ciLow);
+				setRounded(section, ciHighId, sizeIt->first, stats.ciHigh);
+			}
+		}
+	}
+
+	/**
+	* the growth models fitted by fitComplexity, value = a * model(n) + b
+	*/
+	enum ComplexityModel {
+		COMPLEXITY_1 = 0, COMPLEXITY_LOG_N = 1, COMPLEXITY_N = 2, COMPLEXITY_N_LOG_N = 3,
+		COMPLEXITY_N2 = 4, COMPLEXITY_N3 = 5, COMPLEXITY_MODELS = 6
+	};
+
+	static const char *complexityName(int model){
+		static const char *names[COMPLEXITY_MODELS] = { "1", "log n", "n", "n log n", "n^2", "n^3" };
+		return model >= 0 && model < COMPLEXITY_MODELS? names[model]: "?";
+	}
+
+	/**
+	* the model which fits a series best; residual is the root mean square error relative
+	* to the mean value, points the number of sizes used
+	*/
+	struct ComplexityFit{
+		int model;
+		double a, b;
+		double residual;
+		int points;
+	};
+
+	/**
+	* fits a series against every model with least squares, over its positive sizes, and
+	* returns the one with the smallest error; a model only fits if it grows with the series
+	* (a >= 0), and the constant model is taken when the series has less than two sizes
+	*/
+	ComplexityFit fitComplexity(const char *series){
+		std::vector<std::pair<SizeKey, double> > points;
+		mergeShards();
+		seriesPoints(internSeries(series), points);
+		return fitPoints(points);
+	}
+
+	/**
+	* returns the sizes at which two series cross, interpolated between the sizes measured
+	* for both where the sign of their difference changes
+	*/
+	std::vector<double> crossovers(const char *series1, const char *series2){
+		std::vector<std::pair<SizeKey, double> > points1, points2;
+		mergeShards();
+		seriesPoints(internSeries(series1), points1);
+		seriesPoints(internSeries(series2), points2);
+		return crossPoints(points1, points2);
+	}
+
+	/**
+	* creates and shows the report
+	* the counters of the other threads are merged in first, so they must have been joined
+	*/
+	int showReport(){
+		FILE *fout = NULL;
+		bool hasData, hasSequences;
+		char reportName[200];
+		time_t crtTime = time(0);
+		struct tm now;
+#ifdef _MSC_VER
+		localtime_s(&now, &crtTime);
+#else
+        now = *localtime(&crtTime);
+#endif
+
+#ifdef _MSC_VER
+		_snprintf_s(
+#else
+        snprintf(
+#endif
+                            reportName, sizeof(reportName), 
+                            "report-%s-%04d%02d%02d-%02d%02d%02d.html", 
+							title.c_str(),
+							now.tm_year + 1900,
+							now.tm_mon + 1,
+							now.tm_mday,
+							now.tm_hour,
+							now.tm_min,
+							now.tm_sec
+		);
+		fout = openFile(reportName, "wb");
+		mergeShards();
+		fwrite(HtmlGen::htmlFirst, 1, sizeof(HtmlGen::htmlFirst)/sizeof(HtmlGen::htmlFirst[0]), fout);
+
+		//first, show the operation counters
+		fprintf(fout, "{\n\t\"opcount\": {\n");
+		printSection(fout, ownShard.opcount);
+
+		//then the execution times
+		fprintf(fout, "\t},\n\t\"times\": {\n");
+		printSection(fout, ownShard.times);
+
+		//and the hardware performance counters
+		fprintf(fout, "\t},\n\t\"hardware\": {\n");
+		printSection(fout, ownShard.hardware);
+
+		//and the heap allocations
+		fprintf(fout, "\t},\n\t\"memory\": {\n");
+		printSection(fout, ownShard.memory);
+
+        fprintf(fout, "\t},\n\t\"groups\": {\n");
+		//next show the groups, with the call sites of every series counted by more than one line
+		GroupMap allGroups = groups;
+		std::map<SeriesId, std::vector<SeriesId> >::const_iterator siteIt;
+		for(siteIt = siteSeries.begin(); siteIt != siteSeries.end(); ++siteIt){
+			if(siteIt->second.size() > 1){
+				std::vector<std::string> &members = allGroups[seriesNames[siteIt->first] + "_call_sites"];
+				for(size_t i = 0; i < siteIt->second.size(); ++i){
+					members.push_back(seriesNames[siteIt->second[i]]);
+				}
+			}
+		}
+		//and the rows of every grid
+		std::map<std::string, Grid>::const_iterator gridIt;
+		for(gridIt = grids.begin(); gridIt != grids.end(); ++gridIt){
+			std::vector<std::string> &members = allGroups[gridIt->first];
+			std::map<double, SeriesId>::const_iterator row;
+			for(row = gridIt->second.rows.begin(); row != gridIt->second.rows.end(); ++row){
+				members.push_back(seriesNames[row->second]);
+			}
+		}
 		hasSequences = false;
-		for(oit1 = opcountMap.begin(); oit1 != opcountMap.end(); ++oit1){
+		GroupMap::const_iterator git1;
+		std::vector<std::string>::const_iterator git2;
+		for(git1 = allGroups.begin(); git1 != allGroups.end(); ++git1){
+			fprintf(fout, hasSequences? ",\n\t\t\"": "\t\t\"");
 			hasSequences = true;
 			hasData = false;
-			fprintf(fout, "\t\t\"");
-			print_modified(fout, oit1->first.c_str());
+			print_modified(fout, git1->first.c_str());
 			fprintf(fout, "\": [");
-			for(oit2 = oit1->second.begin(); oit2 != oit1->second.end(); ++oit2){
+			for(git2 = git1->second.begin(); git2 != git1->second.end(); ++git2){
+				fprintf(fout, hasData? ", \"": "\"");
 				hasData = true;
-				fprintf(fout, "[%d, %u], ", oit2->first, oit2->second);
+				print_modified(fout, git2->c_str());
+				fprintf(fout, "\"");
+			}
+			fprintf(fout, "]");
+		}
+		fprintf(fout, hasSequences? "\n\t},\n": "\t},\n");
+
+		//the best fitting growth model of every series
+		fprintf(fout, "\t\"fits\": {\n");
+		hasSequences = false;
+		std::map<std::string, SeriesId>::const_iterator sit;
+		for(sit = seriesIds.begin(); sit != seriesIds.end(); ++sit){
+			std::vector<std::pair<SizeKey, double> > points;
+			seriesPoints(sit->second, points);
+			if(points.empty()){
+				continue;
+			}
+			ComplexityFit fit = fitPoints(points);
+			fprintf(fout, hasSequences? ",\n\t\t\"": "\t\t\"");
+			hasSequences = true;
+			print_modified(fout, sit->first.c_str());
+			fprintf(fout, "\": {\"model\": \"%s\", \"a\": %.6g, \"b\": %.6g, \"residual\": %.6g, \"points\": %d}",
+				complexityName(fit.model), fit.a, fit.b, fit.residual, fit.points);
+		}
+
+		//and the sizes where the members of a group cross
+		fprintf(fout, hasSequences? "\n\t},\n\t\"crossovers\": {\n": "\t},\n\t\"crossovers\": {\n");
+		hasSequences = false;
+		for(git1 = groups.begin(); git1 != groups.end(); ++git1){
+			fprintf(fout, hasSequences? ",\n\t\t\"": "\t\t\"");
+			hasSequences = true;
+			hasData = false;
+			print_modified(fout, git1->first.c_str());
+			fprintf(fout, "\": [");
+			for(size_t i = 0; i < git1->second.size(); ++i){
+				for(size_t j = i + 1; j < git1->second.size(); ++j){
+					std::vector<std::pair<SizeKey, double> > points1, points2;
+					seriesPoints(internSeries(git1->second[i].c_str()), points1);
+					seriesPoints(internSeries(git1->second[j].c_str()), points2);
+					std::vector<double> sizes = crossPoints(points1, points2);
+					for(size_t k = 0; k < sizes.size(); ++k){
+						fprintf(fout, hasData? ", [\"": "[\"");
+						hasData = true;
+						print_modified(fout, git1->second[i].c_str());
+						fprintf(fout, "\", \"");
+						print_modified(fout, git1->second[j].c_str());
+						fprintf(fout, "\", %.6g]", sizes[k]);
+					}
+				}
+			}
+			fprintf(fout, "]");
+		}
+		fprintf(fout, hasSequences? "\n\t},\n": "\t},\n");
+
+		//the grids, as a matrix with a row for every y
+		fprintf(fout, "\t\"grids\": {");
+		for(gridIt = grids.begin(); gridIt != grids.end(); ++gridIt){
+			printGrid(fout, gridIt->first, gridIt->second, gridIt == grids.begin());
+		}
+		fprintf(fout, grids.empty()? "},\n": "\n\t},\n");
+
+		//what the instrumentation costs, taken out of the _corrected times
+		fprintf(fout, "\t\"overhead\": {\"increment\": %.3f, \"scope\": %.3f, \"nested\": %.3f},\n",
+			costs.increment, costs.scope[STEADY_CLOCK], costs.nested[STEADY_CLOCK]);
+
+		//the operation counts which wrapped around, and are wrong
+		fprintf(fout, "\t\"overflows\": [");
+		for(size_t i = 0; i < ownShard.overflows.size(); ++i){
+			fprintf(fout, i == 0? "": ", ");
+			print_escaped(fout, seriesName(ownShard.overflows[i]).c_str());
+			fprintf(stderr, "Warning: the operation count %s overflowed\n", seriesName(ownShard.overflows[i]).c_str());
+		}
+		fprintf(fout, "],\n");
+
+		//and where the measurements were taken
+		std::map<std::string, std::string> machine;
+		CollectEnvironment(machine);
+		for(std::map<std::string, std::string>::const_iterator eit = environment.begin(); eit != environment.end(); ++eit){
+			machine[eit->first] = eit->second;
+		}
+		fprintf(fout, "\t\"environment\": {");
+		for(std::map<std::string, std::string>::const_iterator eit = machine.begin(); eit != machine.end(); ++eit){
+			fprintf(fout, eit == machine.begin()? "\n\t\t": ",\n\t\t");
+			print_escaped(fout, eit->first.c_str());
+			fprintf(fout, ": ");
+			print_escaped(fout, eit->second.c_str());
+		}
+		fprintf(fout, "\n\t}\n}\n");
+		fwrite(HtmlGen::htmlLast, 1, sizeof(HtmlGen::htmlLast)/sizeof(HtmlGen::htmlLast[0]), fout);
+		fclose(fout);
+
+#ifdef _MSC_VER
+		ShellExecuteA(NULL, "open", reportName, NULL, NULL, SW_SHOW);
+#endif
+		return 0;
+	}
+
+	/**
+	* the formats written by exportData
+	* EXPORT_CSV: a "report,section,series,size,value" header, then one row per value
+	* EXPORT_JSON_LINES: one {"report", "section", "series", "size", "value"} object per line
+	* EXPORT_BINARY: little endian records, see exportSection
+	*/
+	enum ExportFormat { EXPORT_CSV = 0, EXPORT_JSON_LINES = 1, EXPORT_BINARY = 2 };
+
+	/**
+	* writes every value of the operation counters and timers to the given stream, without
+	* seeking, so it works on pipes and stdout and can be appended to an existing file
+	* returns 0 on success, -1 if a write failed
+	*/
+	int exportData(FILE *fout, int format = EXPORT_CSV){
+		ExportWriter writer(fout, -1);
+		return exportData(writer, format);
+	}
+
+	/**
+	* same as above, for a file descriptor
+	*/
+	int exportData(int fd, int format = EXPORT_CSV){
+		ExportWriter writer(NULL, fd);
+		return exportData(writer, format);
+	}
+
+	/**
+	* saves the current values as the baseline with the given name, in baseline-<name>.csv
+	* returns 0 on success, -1 if the file could not be written
+	*/
+	int saveBaseline(const char *name){
+		std::string fileName = std::string("baseline-") + name + ".csv";
+		FILE *fout = openFile(fileName.c_str(), "wb");
+		if(fout == NULL){
+			return -1;
+		}
+		int result = exportData(fout, EXPORT_CSV);
+		if(fclose(fout) != 0){
+			result = -1;
+		}
+		return result;
+	}
+
+	/**
+	* compares the current values with the baseline saved under the given name
+	* for every series found in both runs, the values at the sizes measured in both are summed,
+	* and the series regressed if its sum grew by more than threshold (0.05 being 5%)
+	* the comparison of every series is written to diff-<name>.csv and the regressions to stdout
+	* returns the number of regressed series, so main can return it to fail a build,
+	* or -1 if the baseline could not be read
+	*/
+	int compareBaseline(const char *name, double threshold = 0.05){
+		BaselineMap baseline, current;
+		std::string fileName = std::string("baseline-") + name + ".csv";
+		if(readBaseline(fileName.c_str(), baseline) != 0){
+			fprintf(stderr, "Profiler: cannot read the baseline %s\n", fileName.c_str());
+			return -1;
+		}
+		mergeShards();
+		collectBaseline(ownShard.opcount, "opcount", current);
+		collectBaseline(ownShard.times, "times", current);
+		collectBaseline(ownShard.hardware, "hardware", current);
+		collectBaseline(ownShard.memory, "memory", current);
+
+		fileName = std::string("diff-") + name + ".csv";
+		FILE *fout = openFile(fileName.c_str(), "wb");
+		if(fout != NULL){
+			fprintf(fout, "section,series,sizes,baseline,current,change,status\n");
+		}
+		int regressions = 0;
+		BaselineMap::const_iterator it;
+		for(it = baseline.begin(); it != baseline.end(); ++it){
+			BaselineMap::const_iterator other = current.find(it->first);
+			if(other == current.end()){
+				writeDiffRow(fout, it->first, 0, 0, 0, 0, "removed");
+				continue;
+			}
+			unsigned long long oldSum = 0, newSum = 0;
+			int sizes = 0;
+			std::map<SizeKey, unsigned long long>::const_iterator sizeIt, match;
+			for(sizeIt = it->second.begin(); sizeIt != it->second.end(); ++sizeIt){
+				match = other->second.find(sizeIt->first);
+				if(match != other->second.end()){
+					oldSum += sizeIt->second;
+					newSum += match->second;
+					++sizes;
+				}
+			}
+			double change = oldSum > 0? (double)newSum / oldSum - 1: (newSum > 0? 1: 0);
+			if(change > threshold){
+				++regressions;
+				printf("Regression in %s %s: %llu -> %llu (%+.1f%%) over %d sizes\n",
+					it->first.first.c_str(), it->first.second.c_str(), oldSum, newSum, change * 100, sizes);
+			}
+			writeDiffRow(fout, it->first, sizes, oldSum, newSum, change,
+				change > threshold? "regressed": (change < -threshold? "improved": "unchanged"));
+		}
+		for(it = current.begin(); it != current.end(); ++it){
+			if(baseline.find(it->first) == baseline.end()){
+				writeDiffRow(fout, it->first, 0, 0, 0, 0, "added");
+			}
+		}
+		if(fout != NULL){
+			fclose(fout);
+		}
+		return regressions;
+	}
+
+	/**
+	* opens the journal where every finished (size, repetition) point is appended, with the
+	* values it added to each series, so that an interrupted evaluation can be resumed
+	* the points already in the file are loaded, and are given back instead of being measured
+	* again by sweep, repeat and journalDone, as long as the profiler has the same title
+	* a point is known by the title, size and repetition only, so two loops of the same title
+	* must not measure the same sizes; delete the file to measure everything again
+	* returns the number of points loaded, or -1 if the file could not be opened
+	*/
+	int openJournal(const char *fileName){
+		closeJournal();
+		int loaded = readJournal(fileName);
+		journal = openFile(fileName, "ab");
+		if(journal == NULL){
+			fprintf(stderr, "Profiler: cannot open the journal %s\n", fileName);
+			return -1;
+		}
+		return loaded;
+	}
+
+	void closeJournal(){
+		if(journal != NULL){
+			fclose(journal);
+			journal = NULL;
+		}
+		journalPoints.clear();
+		journalPending.clear();
+	}
+
+	/**
+	* for loops which do not go through sweep or repeat:
+	*     if(profiler.journalDone(n)) continue;
+	*     ... measure at size n ...
+	*     profiler.journalCommit(n);
+	* journalDone returns true if the point is in the journal, after adding its values to the
+	* series; otherwise it remembers the current values, which journalCommit compares with
+	* both must be called by the thread which constructed the profiler
+	*/
+	bool journalDone(SizeKey size, int repetition = 0){
+		if(journal == NULL){
+			return false;
+		}
+		mergeShards();
+		if(restorePoint(ownShard, size, repetition)){
+			return true;
+		}
+		takeJournalSnapshot(ownShard, size, journalPending[std::make_pair(size, repetition)]);
+		return false;
+	}
+
+	void journalCommit(SizeKey size, int repetition = 0){
+		std::map<std::pair<SizeKey, int>, PointSnapshot>::iterator it = journalPending.find(std::make_pair(size, repetition));
+		if(journal == NULL || it == journalPending.end()){
+			return;
+		}
+		mergeShards();
+		commitPoint(ownShard, size, repetition, it->second);
+		journalPending.erase(it);
+	}
+
+	/**
+	* adds a line to the environment table of the report, next to the machine description
+	* which every report has
+	*/
+	void addEnvironment(const char *key, const char *value){
+		environment[key] = value? value: "";
+	}
+
+	/**
+	* makes the measurements of benchmark steadier: the calling thread is pinned to the
+	* given processor (-1 leaves it where it is) until the profiler is destroyed or this is
+	* called again, benchmark runs its body warmups times before the measured run, and with
+	* coldCache it evicts the caches right before the measured run
+	* the settings are written to the environment of the report
+	* returns false if the thread could not be pinned
+	*/
+	bool setNoiseControl(int cpu = 0, int warmups = 3, bool coldCache = false){
+		char text[32];
+		UnpinThread(affinity);
+		bool pinned = cpu >= 0 && PinThread(cpu, affinity);
+		noiseWarmups = (std::max)(0, warmups);
+		noiseColdCache = coldCache;
+		snprintf(text, sizeof(text), "%d", cpu);
+		environment["pinned to cpu"] = cpu < 0? "no": pinned? text: "no, pinning failed";
+		snprintf(text, sizeof(text), "%d", noiseWarmups);
+		environment["warmup runs"] = text;
+		environment["cold cache"] = coldCache? "yes": "no";
+		return pinned || cpu < 0;
+	}
+
+	/**
+	* calls prepare() and then body(), first for the warmup runs set by setNoiseControl and
+	* then for the measured run; what the warmup runs added to the counters and timers at
+	* this size is taken back, so only the measured run is kept
+	* prepare is not measured: it should put back the input that body changes
+	* it must be called by the thread which constructed the profiler
+	*/
+	template <typename P, typename B>
+	void benchmark(SizeKey size, P prepare, B body){
+		if(noiseWarmups > 0){
+			PointSnapshot before;
+			mergeShards();
+			takePointSnapshot(ownShard, size, before);
+			for(int run = 0; run < noiseWarmups; ++run){
+				prepare();
+				body();
 			}
-			if(hasData){
-				fseek(fout, -2, SEEK_CUR);
+			mergeShards();
+			rollbackPoint(ownShard, size, before);
+		}
+		prepare();
+		if(noiseColdCache){
+			FlushCaches();
+		}
+		body();
+	}
+
+private:
+	typedef unsigned long long OPCOUNT_MEASURE;
+
+	typedef std::map<std::string, std::vector<std::string> > GroupMap;
+
+	typedef unsigned long long TIME_MEASURE;
+
+	typedef unsigned long long HARDWARE_MEASURE;
+
+	typedef unsigned long long MEMORY_MEASURE;
+
+	/**
+	* the sections of the report, each one with its own series
+	*/
+	enum Section { OPCOUNT_SECTION = 0, TIMES_SECTION = 1, HARDWARE_SECTION = 2, MEMORY_SECTION = 3, SECTION_COUNT = 4 };
+
+	static const int PERF_EVENT_COUNT = 6;
+
+	/**
+	* the hardware counters of one thread, opened on first use and kept running, so that a
+	* measurement is the difference between two reads
+	*/
+	class PerfEvents{
+		int fds[PERF_EVENT_COUNT];
+	  public:
+		PerfEvents(){
+			for(int i = 0; i < PERF_EVENT_COUNT; ++i){
+				fds[i] = open(i);
+			}
+		}
+
+		~PerfEvents(){
+#ifdef __linux__
+			for(int i = 0; i < PERF_EVENT_COUNT; ++i){
+				if(fds[i] >= 0){
+					close(fds[i]);
+				}
+			}
+#endif
+		}
+
+		bool available(int event) const { return fds[event] >= 0; }
+
+		/**
+		* returns the value of the event, scaled up if the kernel had to multiplex the counters
+		*/
+		HARDWARE_MEASURE read(int event) const {
+#ifdef __linux__
+			unsigned long long data[3]; // value, time enabled, time running
+			if(fds[event] >= 0 && ::read(fds[event], data, sizeof(data)) == (ssize_t)sizeof(data)){
+				if(data[2] != 0 && data[2] < data[1]){
+					return (HARDWARE_MEASURE)((double)data[0] * data[1] / data[2]);
+				}
+				return data[0];
+			}
+#endif
+			return 0;
+		}
+
+	  private:
+		PerfEvents(const PerfEvents&);
+		PerfEvents &operator=(const PerfEvents&);
+
+		/**
+		* opens a counter of the calling thread, in user space only, so it works with the
+		* default perf_event_paranoid setting; returns -1 if it is not allowed or not supported
+		*/
+		static int open(int event){
+#ifdef __linux__
+			struct perf_event_attr attr;
+			memset(&attr, 0, sizeof(attr));
+			attr.size = sizeof(attr);
+			attr.exclude_kernel = 1;
+			attr.exclude_hv = 1;
+			attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+			switch(event){
+			case 0:
+				attr.type = PERF_TYPE_HARDWARE;
+				attr.config = PERF_COUNT_HW_CPU_CYCLES;
+				break;
+			case 1:
+				attr.type = PERF_TYPE_HARDWARE;
+				attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+				break;
+			case 2:
+				attr.type = PERF_TYPE_HW_CACHE;
+				attr.config = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+				break;
+			case 3:
+				attr.type = PERF_TYPE_HARDWARE;
+				attr.config = PERF_COUNT_HW_CACHE_MISSES;
+				break;
+			case 4:
+				attr.type = PERF_TYPE_HARDWARE;
+				attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+				break;
+			default:
+				attr.type = PERF_TYPE_HW_CACHE;
+				attr.config = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+				break;
+			}
+			return (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+#else
+			(void)event;
+			return -1;
+#endif
+		}
+	};
+
+	/**
+	* the values of a series, indexed by size
+	* the sizes below DENSE_LIMIT are stored in pages of consecutive sizes, and the others,
+	* such as the sizes of a sweep up to 10^9, in a map; neither moves a value once it is
+	* created, so a counter can keep the address of its value
+	*/
+	template <typename T>
+	class SizeTable{
+		static const int PAGE_BITS = 8;
+		static const int PAGE_SIZE = 1 << PAGE_BITS;
+		static const SizeKey DENSE_LIMIT = (SizeKey)1 << 24;
+
+		struct Page{
+			T values[PAGE_SIZE];
+			bool present[PAGE_SIZE];
+		};
+		std::vector<std::unique_ptr<Page> > pages;
+		std::map<SizeKey, T> sparseSizes;
+		int presentCount;
+
+		static bool dense(SizeKey size) { return size >= 0 && size < DENSE_LIMIT; }
+
+	  public:
+		SizeTable() : presentCount(0) {}
+
+		/**
+		* returns the value at the given size, creating it with 0 if it did not exist
+		*/
+		T &cell(SizeKey size){
+			if(!dense(size)){
+				if(sparseSizes.find(size) == sparseSizes.end()){
+					++presentCount;
+				}
+				return sparseSizes[size];
+			}
+			size_t page = (size_t)size >> PAGE_BITS;
+			int offset = (int)(size & (PAGE_SIZE - 1));
+			if(page >= pages.size()){
+				pages.resize(page + 1);
+			}
+			if(!pages[page]){
+				pages[page].reset(new Page());
+			}
+			if(!pages[page]->present[offset]){
+				pages[page]->present[offset] = true;
+				++presentCount;
+			}
+			return pages[page]->values[offset];
+		}
+
+		/**
+		* returns the value at the given size, or NULL if it does not exist
+		*/
+		T *find(SizeKey size){
+			if(!dense(size)){
+				typename std::map<SizeKey, T>::iterator it = sparseSizes.find(size);
+				return it == sparseSizes.end()? NULL: &it->second;
+			}
+			size_t page = (size_t)size >> PAGE_BITS;
+			int offset = (int)(size & (PAGE_SIZE - 1));
+			if(page >= pages.size() || !pages[page] || !pages[page]->present[offset]){
+				return NULL;
+			}
+			return &pages[page]->values[offset];
+		}
+
+		bool empty() const { return presentCount == 0; }
+		int count() const { return presentCount; }
+
+		/**
+		* calls f(size, value) for every existing size, in increasing order: the negative
+		* sparse sizes, the dense ones, then the sparse sizes above them
+		*/
+		template <typename F>
+		void forEach(F f){
+			typename std::map<SizeKey, T>::iterator it;
+			for(it = sparseSizes.begin(); it != sparseSizes.end() && it->first < 0; ++it){
+				f(it->first, it->second);
+			}
+			for(size_t page = 0; page < pages.size(); ++page){
+				if(!pages[page]){
+					continue;
+				}
+				for(int offset = 0; offset < PAGE_SIZE; ++offset){
+					if(pages[page]->present[offset]){
+						f((SizeKey)(page << PAGE_BITS) + offset, pages[page]->values[offset]);
+					}
+				}
+			}
+			for(; it != sparseSizes.end(); ++it){
+				f(it->first, it->second);
+			}
+		}
+	};
+
+	struct RunningTimer{
+		int backend;
+		TIME_MEASURE start;
+		TIME_MEASURE *corrected;
+		unsigned long long startIncrements;
+		double startNested;
+	};
+	typedef std::map<SeriesId, std::map<SizeKey, RunningTimer> > RunningTimerMap;
+
+	/**
+	* a line counting a series at a size; file is the pointer given by __builtin_FILE
+	*/
+	struct CallSite{
+		SeriesId series;
+		SizeKey size;
+		const char *file;
+		int line;
+
+		bool operator<(const CallSite &other) const {
+			if(series != other.series) return series < other.series;
+			if(size != other.size) return size < other.size;
+			if(file != other.file) return std::less<const char*>()(file, other.file);
+			return line < other.line;
+		}
+	};
+	typedef std::map<CallSite, OPCOUNT_MEASURE*> CallSiteMap;
+
+	/**
+	* the call sites of a shard, with a direct mapped cache in front of the map, because
+	* counting happens in the innermost loops
+	*/
+	struct CallSites{
+		static const int CACHE_SIZE = 1024;
+		struct Entry{
+			CallSite site;
+			OPCOUNT_MEASURE *cell;
+		};
+		CallSiteMap sites;
+		std::vector<Entry> cache;
+	};
+
+	/**
+	* the series written by a single thread, indexed by their id
+	*/
+	struct Shard{
+		std::vector<SizeTable<OPCOUNT_MEASURE> > opcount;
+		std::vector<SizeTable<TIME_MEASURE> > times;
+		std::vector<SizeTable<HARDWARE_MEASURE> > hardware;
+		std::vector<SizeTable<MEMORY_MEASURE> > memory;
+		RunningTimerMap runningTimers;
+		std::unique_ptr<PerfEvents> perfEvents;
+		CallSites callSites;
+		unsigned long long increments; // every count() of the thread
+		double nestedOverhead; // what its finished timers added to the timers around them
+		std::vector<SeriesId> overflows; // the series whose count wrapped around
+
+		Shard() : increments(0), nestedOverhead(0) {}
+
+		bool empty() const {
+			for(size_t i = 0; i < opcount.size(); ++i){
+				if(!opcount[i].empty()){
+					return false;
+				}
+			}
+			for(size_t i = 0; i < times.size(); ++i){
+				if(!times[i].empty()){
+					return false;
+				}
+			}
+			for(size_t i = 0; i < hardware.size(); ++i){
+				if(!hardware[i].empty()){
+					return false;
+				}
+			}
+			for(size_t i = 0; i < memory.size(); ++i){
+				if(!memory[i].empty()){
+					return false;
+				}
+			}
+			return true;
+		}
+	};
+
+	/**
+	* the value a finished point added to one series
+	*/
+	struct JournalValue{
+		int section;
+		SeriesId series;
+		unsigned long long value;
+	};
+
+	struct JournalPoint{
+		std::vector<JournalValue> values;
+		bool restored;
+		JournalPoint() : restored(false) {}
+	};
+
+	/**
+	* the journal points of a title, by (size, repetition)
+	*/
+	typedef std::map<std::pair<SizeKey, int>, JournalPoint> JournalPointMap;
+
+	/**
+	* the values of every section at one size, -1 for the series which did not exist there
+	*/
+	struct PointSnapshot{
+		std::vector<long long> values[SECTION_COUNT];
+	};
+
+	/**
+	* the samples taken by repeat, for every series and size
+	*/
+	typedef std::map<SeriesId, std::map<SizeKey, std::vector<double> > > SampleMap;
+
+	/**
+	* what repeat knows about the series of a section at the repeated size
+	*/
+	struct SampleSet{
+		std::vector<char> existed, changed;
+		std::vector<double> initial, before;
+		std::vector<std::vector<double> > values;
+	};
+
+	template <typename T>
+	static void takeSnapshot(std::vector<SizeTable<T> > &tables, SizeKey size, SampleSet &set, bool first){
+		set.before.assign(tables.size(), 0);
+		if(first){
+			set.existed.assign(tables.size(), 0);
+			set.initial.assign(tables.size(), 0);
+		}
+		for(size_t id = 0; id < tables.size(); ++id){
+			T *value = tables[id].find(size);
+			if(value != NULL){
+				set.before[id] = (double)*value;
+				if(first){
+					set.existed[id] = 1;
+					set.initial[id] = (double)*value;
+				}
+			}
+		}
+	}
+
+	/**
+	* a series takes part in the repetition if it was created or changed by one of the runs;
+	* the runs before its creation count as 0
+	*/
+	template <typename T>
+	static void collectSamples(std::vector<SizeTable<T> > &tables, SizeKey size, SampleSet &set, int repetition){
+		set.existed.resize(tables.size(), 0);
+		set.initial.resize(tables.size(), 0);
+		set.before.resize(tables.size(), 0);
+		set.changed.resize(tables.size(), 0);
+		set.values.resize(tables.size());
+		for(size_t id = 0; id < tables.size(); ++id){
+			T *value = tables[id].find(size);
+			if(value == NULL){
+				continue;
+			}
+			double delta = (double)*value - set.before[id];
+			if(!set.existed[id] || delta != 0){
+				set.changed[id] = 1;
+			}
+			set.values[id].resize(repetition, 0.0);
+			set.values[id].push_back(delta);
+		}
+	}
+
+	static bool isPrecise(const SampleSet &set, double maxRelativeError){
+		for(size_t id = 0; id < set.changed.size(); ++id){
+			if(set.changed[id]){
+				Statistics stats = computeStatistics(set.values[id]);
+				if(stats.samples < 2 || stats.ciHigh - stats.mean > maxRelativeError * fabs(stats.mean)){
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+
+	template <typename T>
+	static void storeSamples(std::vector<SizeTable<T> > &tables, SizeKey size, SampleSet &set, SampleMap &store, int repetitions){
+		for(size_t id = 0; id < set.changed.size(); ++id){
+			if(set.changed[id]){
+				set.values[id].resize(repetitions, 0.0);
+				Statistics stats = computeStatistics(set.values[id]);
+				tables[id].cell(size) = (T)(set.initial[id] + floor(stats.mean + 0.5));
+				store[(SeriesId)id][size] = set.values[id];
+			}
+		}
+	}
+
+	static Statistics computeStatistics(std::vector<double> values){
+		// two sided 95% quantiles of Student's t distribution, for 1 to 30 degrees of freedom
+		static const double t95[] = {
+			12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+			2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+			2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042
+		};
+		Statistics stats;
+		size_t n = values.size();
+		double sum = 0, squares = 0, halfWidth = 0;
+		memset(&stats, 0, sizeof(stats));
+		stats.samples = (int)n;
+		if(n == 0){
+			return stats;
+		}
+		std::sort(values.begin(), values.end());
+		for(size_t i = 0; i < n; ++i){
+			sum += values[i];
+		}
+		stats.mean = sum / n;
+		for(size_t i = 0; i < n; ++i){
+			squares += (values[i] - stats.mean) * (values[i] - stats.mean);
+		}
+		stats.min = values[0];
+		stats.max = values[n - 1];
+		stats.median = percentile(values, 0.5);
+		stats.p95 = percentile(values, 0.95);
+		if(n > 1){
+			stats.stddev = sqrt(squares / (n - 1));
+			halfWidth = (n - 1 <= 30? t95[n - 2]: 1.96) * stats.stddev / sqrt((double)n);
+		}
+		stats.ciLow = stats.mean - halfWidth;
+		stats.ciHigh = stats.mean + halfWidth;
+		return stats;
+	}
+
+	/**
+	* linear interpolation between the closest ranks of the sorted values
+	*/
+	static double percentile(const std::vector<double> &sorted, double fraction){
+		double rank = fraction * (sorted.size() - 1);
+		size_t below = (size_t)rank;
+		if(below + 1 >= sorted.size()){
+			return sorted[sorted.size() - 1];
+		}
+		return sorted[below] + (rank - below) * (sorted[below + 1] - sorted[below]);
+	}
+
+	void setRounded(int section, SeriesId series, SizeKey size, double value){
+		value = value < 0? 0: floor(value + 0.5);
+		if(section == OPCOUNT_SECTION){
+			tableCell(ownShard.opcount, series, size) = (OPCOUNT_MEASURE)value;
+		}else if(section == TIMES_SECTION){
+			tableCell(ownShard.times, series, size) = (TIME_MEASURE)value;
+		}else if(section == HARDWARE_SECTION){
+			tableCell(ownShard.hardware, series, size) = (HARDWARE_MEASURE)value;
+		}else{
+			tableCell(ownShard.memory, series, size) = (MEMORY_MEASURE)value;
+		}
+	}
+
+	/**
+	* returns the value of a series at the given size, creating both if needed
+	*/
+	template <typename T>
+	static T &tableCell(std::vector<SizeTable<T> > &tables, SeriesId series, SizeKey size){
+		if(tables.size() <= (size_t)series){
+			tables.resize(series + 1);
+		}
+		return tables[series].cell(size);
+	}
+
+public:
+	/**
+	* counters created by other threads than the one which constructed the profiler
+	* are kept in a shard of their thread, so counting never needs synchronization
+	* the shards are merged in the same order on every report
+	*/
+	class OperationCounter{
+		OPCOUNT_MEASURE *value;
+		Profiler *profiler;
+		Shard *shard;
+		SeriesId series;
+		SizeKey size;
+		friend class Profiler;
+		OperationCounter(Profiler &prof, SeriesId givenSeries, SizeKey givenSize) : profiler(&prof), series(givenSeries), size(givenSize) {
+			shard = &profiler->crtShard();
+			value = &tableCell(shard->opcount, series, size); // force creation
+		}
+	  public:
+		/**
+		* with PROFILER_CALL_SITES defined before including Profiler.h, in every source file
+		* of the program, every increment is also added to the series <series>@<file>:<line>
+		* of the line which called count, and the report groups them as <series>_call_sites;
+		* it needs __builtin_FILE and __builtin_LINE (GCC, Clang, or MSVC 2019 16.6 and later)
+		*/
+#ifdef PROFILER_CALL_SITES
+		void count(long long increment=1, const char *file = __builtin_FILE(), int line = __builtin_LINE()) {
+			addCount(*shard, series, *value, increment);
+			++shard->increments;
+			profiler->countSite(*shard, series, size, file, line, increment);
+		}
+#else
+		void count(long long increment=1) {
+			addCount(*shard, series, *value, increment);
+			++shard->increments;
+		}
+#endif
+		OPCOUNT_MEASURE get() const { return *value; }
+
+		/**
+		* returns a counter of the same series and size for the calling thread
+		* a worker thread should call it once, before counting with the received operation
+		*/
+		OperationCounter local() const { return OperationCounter(*profiler, series, size); }
+	};
+	
+	OperationCounter createOperation(const char *name, SizeKey size) {
+		return OperationCounter(*this, internSeries(name), size);
+	}
+
+	/**
+	* creates a counter from an interned series, without allocating once its size was seen
+	*/
+	OperationCounter createOperation(SeriesId series, SizeKey size) {
+		return OperationCounter(*this, series, size);
+	}
+
+	/**
+	* the clocks that can measure a timer
+	* RDTSC reads the time stamp counter and converts it to nanoseconds, it falls back
+	* to STEADY_CLOCK on processors that do not have one
+	*/
+	enum TimerBackend { STEADY_CLOCK = 0, RDTSC = 1 };
+
+	class TimerCounter{
+		TIME_MEASURE *value;
+		TIME_MEASURE *corrected;
+		Profiler *profiler;
+		Shard *shard;
+		SeriesId series;
+		SizeKey size;
+		int backend;
+		TIME_MEASURE startStamp;
+		unsigned long long startIncrements;
+		double startNested;
+		friend class Profiler;
+		TimerCounter(Profiler &prof, SeriesId givenSeries, SizeKey givenSize, int givenBackend)
+			: corrected(NULL), profiler(&prof), series(givenSeries), size(givenSize), backend(givenBackend),
+			startStamp(0), startIncrements(0), startNested(0) {
+			shard = &profiler->crtShard();
+			value = &tableCell(shard->times, series, size); // force creation
+			corrected = &profiler->correctedCell(*shard, series, size); // here, not in the measured start
+		}
+	  public:
+		void start() {
+			startIncrements = shard->increments;
+			startNested = shard->nestedOverhead;
+			startStamp = readTimestamp(backend);
+		}
+
+		void stop() {
+			TIME_MEASURE elapsed = elapsedNanoseconds(backend, startStamp, readTimestamp(backend));
+			*value += elapsed;
+			*corrected += profiler->correctTime(*shard, backend, elapsed, startIncrements, startNested);
+		}
+
+		TIME_MEASURE get() const { return *value; }
+		/**
+		* adds time measured elsewhere, which the profiler added no overhead to
+		*/
+		void add(TIME_MEASURE nanoseconds) {
+			*value += nanoseconds;
+			*corrected += nanoseconds;
+		}
+		TimerCounter local() const { return TimerCounter(*profiler, series, size, backend); }
+	};
+
+	TimerCounter createTimer(const char *name, SizeKey size, int backend = STEADY_CLOCK) {
+		return TimerCounter(*this, internSeries(name), size, backend);
+	}
+
+	TimerCounter createTimer(SeriesId series, SizeKey size, int backend = STEADY_CLOCK) {
+		return TimerCounter(*this, series, size, backend);
+	}
+
+	/**
+	* the hardware events a PerfCounter can measure, on Linux through perf_event_open
+	* their series are <name>_cycles, _instructions, _l1d_misses, _llc_misses, _branch_misses
+	* and _dtlb_misses, in the "hardware" section of the report
+	*/
+	enum PerfEvent {
+		PERF_CYCLES = 1, PERF_INSTRUCTIONS = 2, PERF_L1_MISSES = 4, PERF_LLC_MISSES = 8,
+		PERF_BRANCH_MISSES = 16, PERF_TLB_MISSES = 32, PERF_ALL = 63
+	};
+
+	/**
+	* measures the hardware events of the calling thread between start() and stop()
+	* events which the kernel or the processor does not allow (see perf_event_paranoid) are
+	* left out of the report, and a warning names them once
+	*/
+	class PerfCounter{
+		HARDWARE_MEASURE *values[PERF_EVENT_COUNT];
+		HARDWARE_MEASURE startValues[PERF_EVENT_COUNT];
+		const PerfEvents *events;
+		friend class Profiler;
+		PerfCounter(Profiler &prof, const char *name, SizeKey size, int selected) {
+			Shard &shard = prof.crtShard();
+			static const char *suffixes[PERF_EVENT_COUNT] = {
+				"_cycles", "_instructions", "_l1d_misses", "_llc_misses", "_branch_misses", "_dtlb_misses"
+			};
+			if(!shard.perfEvents){
+				shard.perfEvents.reset(new PerfEvents());
+				warnUnavailable(*shard.perfEvents);
+			}
+			events = shard.perfEvents.get();
+			for(int i = 0; i < PERF_EVENT_COUNT; ++i){
+				values[i] = NULL;
+				startValues[i] = 0;
+				if((selected & (1 << i)) && events->available(i)){
+					SeriesId series = prof.internSeries((std::string(name) + suffixes[i]).c_str());
+					values[i] = &tableCell(shard.hardware, series, size); // force creation
+				}
+			}
+		}
+	  public:
+		void start() {
+			for(int i = 0; i < PERF_EVENT_COUNT; ++i){
+				if(values[i] != NULL){
+					startValues[i] = events->read(i);
+				}
+			}
+		}
+
+		void stop() {
+			for(int i = 0; i < PERF_EVENT_COUNT; ++i){
+				if(values[i] != NULL){
+					HARDWARE_MEASURE stopValue = events->read(i);
+					*values[i] += stopValue > startValues[i]? stopValue - startValues[i]: 0;
+				}
+			}
+		}
+	};
+
+	PerfCounter createPerfCounter(const char *name, SizeKey size, int events = PERF_ALL) {
+		return PerfCounter(*this, name, size, events);
+	}
+
+	/**
+	* the heap usage of one thread, kept up to date by the allocation hooks
+	* current can go below zero when the thread frees memory allocated elsewhere
+	*/
+	struct AllocationState{
+		unsigned long long allocs;
+		unsigned long long bytes;
+		long long current;
+		long long peak;
+	};
+
+	static AllocationState &allocationState() {
+		static thread_local AllocationState state = {0, 0, 0, 0};
+		return state;
+	}
+
+	/**
+	* set by the translation unit defining PROFILER_TRACK_ALLOCATIONS
+	*/
+	static bool &allocationHooksInstalled() {
+		static bool installed = false;
+		return installed;
+	}
+
+	static void recordAllocation(size_t bytes) {
+		AllocationState &state = allocationState();
+		++state.allocs;
+		state.bytes += bytes;
+		state.current += bytes;
+		if(state.current > state.peak){
+			state.peak = state.current;
+		}
+	}
+
+	static void recordFree(size_t bytes) {
+		allocationState().current -= bytes;
+	}
+
+	/**
+	* measures the heap allocations of the calling thread between start() and stop(), as
+	* the series <name>_allocs (number of allocations), <name>_bytes (bytes allocated) and
+	* <name>_peak_bytes (the most bytes alive at once, above what was alive at start())
+	* the allocations are only seen if exactly one translation unit of the program defines
+	* PROFILER_TRACK_ALLOCATIONS before including Profiler.h; the hooks cover malloc and
+	* operator new with glibc, and operator new with MSVC
+	*/
+	class AllocationCounter{
+		MEMORY_MEASURE *allocs;
+		MEMORY_MEASURE *bytes;
+		MEMORY_MEASURE *peak;
+		AllocationState startState;
+		friend class Profiler;
+		AllocationCounter(Profiler &prof, const char *name, SizeKey size) {
+			Shard &shard = prof.crtShard();
+			std::string prefix(name);
+			allocs = &tableCell(shard.memory, prof.internSeries((prefix + "_allocs").c_str()), size);
+			bytes = &tableCell(shard.memory, prof.internSeries((prefix + "_bytes").c_str()), size);
+			peak = &tableCell(shard.memory, prof.internSeries((prefix + "_peak_bytes").c_str()), size);
+			startState = allocationState();
+			static bool warned = false;
+			if(!allocationHooksInstalled() && !warned){
+				warned = true;
+				fprintf(stderr, "Profiler: allocations are not tracked, define PROFILER_TRACK_ALLOCATIONS "
+					"in one source file before including Profiler.h\n");
+			}
+		}
+	  public:
+		void start() {
+			AllocationState &state = allocationState();
+			startState = state;
+			state.peak = state.current;
+		}
+
+		void stop() {
+			AllocationState &state = allocationState();
+			*allocs += state.allocs - startState.allocs;
+			*bytes += state.bytes - startState.bytes;
+			long long scopePeak = state.peak - startState.current;
+			if(scopePeak > 0 && (MEMORY_MEASURE)scopePeak > *peak){
+				*peak = (MEMORY_MEASURE)scopePeak;
+			}
+			//an enclosing counter still sees the peak of its own scope
+			state.peak = (std::max)(state.peak, startState.peak);
+		}
+	};
+
+	AllocationCounter createAllocationCounter(const char *name, SizeKey size) {
+		return AllocationCounter(*this, name, size);
+	}
+
+	/**
+	* returns the PerfEvent flags which can be measured on the calling thread
+	*/
+	int availablePerfEvents() {
+		int available = 0;
+		Shard &shard = crtShard();
+		if(!shard.perfEvents){
+			shard.perfEvents.reset(new PerfEvents());
+			warnUnavailable(*shard.perfEvents);
+		}
+		for(int i = 0; i < PERF_EVENT_COUNT; ++i){
+			if(shard.perfEvents->available(i)){
+				available |= 1 << i;
+			}
+		}
+		return available;
+	}
+
+private:
+	std::string title;
+	Shard ownShard;
+	GroupMap groups;
+	std::map<std::string, SeriesId> seriesIds;
+	std::vector<std::string> seriesNames;
+	std::vector<SeriesId> correctedIds; // by series, -1 until correctedSeries is called for it
+	SampleMap samples[SECTION_COUNT];
+
+	std::thread::id owner;
+	Overhead costs;
+	std::mutex registryLock;
+	std::map<std::thread::id, Shard*> threadShards;
+	std::list<Shard> shards;
+	std::map<SeriesId, std::vector<SeriesId> > siteSeries;
+
+	FILE *journal;
+	std::mutex journalLock;
+	std::map<std::string, JournalPointMap> journalPoints;
+	std::map<std::pair<SizeKey, int>, PointSnapshot> journalPending;
+
+	std::map<std::string, std::string> environment;
+
+	struct Grid{
+		std::string xLabel, yLabel;
+		std::map<double, SeriesId> rows;
+	};
+	std::map<std::string, Grid> grids;
+	ThreadAffinity affinity;
+	int noiseWarmups;
+	bool noiseColdCache;
+
+	/**
+	* returns the shard of the calling thread, creating it on first use
+	*/
+	Shard &crtShard(){
+		std::thread::id id = std::this_thread::get_id();
+		if(id == owner){
+			return ownShard;
+		}
+		std::lock_guard<std::mutex> lock(registryLock);
+		std::map<std::thread::id, Shard*>::iterator it = threadShards.find(id);
+		if(it == threadShards.end()){
+			shards.push_back(Shard());
+			it = threadShards.insert(std::make_pair(id, &shards.back())).first;
+		}
+		return *it->second;
+	}
+
+	/**
+	* adds the values of the thread shards to the profiler's own series, in the order the
+	* shards were created, and clears them so a later merge does not count them twice
+	*/
+	void mergeShards(){
+		std::list<Shard>::iterator it;
+		std::lock_guard<std::mutex> lock(registryLock);
+		for(it = shards.begin(); it != shards.end(); ++it){
+			mergeSeries(ownShard.opcount, it->opcount);
+			mergeSeries(ownShard.times, it->times);
+			mergeSeries(ownShard.hardware, it->hardware);
+			mergeSeries(ownShard.memory, it->memory);
+			for(size_t i = 0; i < it->overflows.size(); ++i){
+				noteOverflow(ownShard, it->overflows[i]);
+			}
+			it->overflows.clear();
+		}
+	}
+
+	template <typename T>
+	static void mergeSeries(std::vector<SizeTable<T> > &dst, std::vector<SizeTable<T> > &src){
+		for(SeriesId series = 0; series < (SeriesId)src.size(); ++series){
+			src[series].forEach([&](SizeKey size, T &value){
+				tableCell(dst, series, size) += value;
+				value = 0;
+			});
+		}
+	}
+
+	/**
+	* adds the increment to a count of the series, noting the series if the count wrapped
+	* around 2^64, or below 0 for a negative increment
+	*/
+	static void addCount(Shard &shard, SeriesId series, OPCOUNT_MEASURE &value, long long increment){
+		OPCOUNT_MEASURE before = value;
+		value += increment;
+		if(increment >= 0? value < before: value > before){
+			noteOverflow(shard, series);
+		}
+	}
+
+	static void noteOverflow(Shard &shard, SeriesId series){
+		if(std::find(shard.overflows.begin(), shard.overflows.end(), series) == shard.overflows.end()){
+			shard.overflows.push_back(series);
+		}
+	}
+
+	/**
+	* adds the increment to the series of the call site, in the shard of the counter
+	*/
+	void countSite(Shard &shard, SeriesId series, SizeKey size, const char *file, int line, long long increment){
+		CallSites &callSites = shard.callSites;
+		if(callSites.cache.empty()){
+			CallSites::Entry empty = { { -1, 0, NULL, 0 }, NULL };
+			callSites.cache.assign(CallSites::CACHE_SIZE, empty);
+		}
+		size_t slot = ((size_t)series * 31 + (size_t)size * 131 + (size_t)line * 8191 + (size_t)file) & (CallSites::CACHE_SIZE - 1);
+		CallSites::Entry &entry = callSites.cache[slot];
+		if(entry.site.series == series && entry.site.size == size && entry.site.line == line && entry.site.file == file){
+			*entry.cell += increment;
+			return;
+		}
+		CallSite key = { series, size, file, line };
+		CallSiteMap::iterator it = callSites.sites.find(key);
+		if(it == callSites.sites.end()){
+			const char *base = file;
+			for(const char *c = file; *c != 0; ++c){
+				if(*c == '/' || *c == '\\'){
+					base = c + 1;
+				}
+			}
+			std::string name = seriesName(series) + "@" + base + ":" + std::to_string(line);
+			SeriesId site = internSeries(name.c_str());
+			{
+				std::lock_guard<std::mutex> lock(registryLock);
+				std::vector<SeriesId> &sites = siteSeries[series];
+				if(std::find(sites.begin(), sites.end(), site) == sites.end()){
+					sites.push_back(site);
+				}
+			}
+			it = callSites.sites.insert(std::make_pair(key, &tableCell(shard.opcount, site, size))).first;
+		}
+		entry.site = key;
+		entry.cell = it->second;
+		*it->second += increment;
+	}
+
+	/**
+	* the profiler which measures the overhead, without correcting its own timers
+	*/
+	Profiler(const char *givenTitle, const Overhead &givenCosts) : owner(std::this_thread::get_id()), costs(givenCosts), journal(NULL), noiseWarmups(0), noiseColdCache(false) {
+		reset(givenTitle);
+	}
+
+	TIME_MEASURE &correctedCell(Shard &shard, SeriesId series, SizeKey size){
+		return tableCell(shard.times, correctedSeries(series), size);
+	}
+
+	/**
+	* the <series>_corrected series, interned on the first call for the series and then
+	* taken from correctedIds
+	*/
+	SeriesId correctedSeries(SeriesId series){
+		{
+			std::lock_guard<std::mutex> lock(registryLock);
+			if((size_t)series < correctedIds.size() && correctedIds[series] >= 0){
+				return correctedIds[series];
+			}
+		}
+		SeriesId corrected = internSeries((seriesName(series) + "_corrected").c_str());
+		std::lock_guard<std::mutex> lock(registryLock);
+		if(correctedIds.size() <= (size_t)series){
+			correctedIds.resize(series + 1, -1);
+		}
+		correctedIds[series] = corrected;
+		return corrected;
+	}
+
+	/**
+	* returns the elapsed time of a timer without the overhead of its own start and stop, of
+	* the counting done while it ran and of the timers which ran inside it
+	* and adds the overhead of its start and stop to the timers around it
+	*/
+	TIME_MEASURE correctTime(Shard &shard, int backend, TIME_MEASURE elapsed, unsigned long long startIncrements, double startNested){
+		double overhead = costs.scope[backend] + costs.increment * (double)(shard.increments - startIncrements) +
+			(shard.nestedOverhead - startNested);
+		shard.nestedOverhead += costs.nested[backend];
+		return (double)elapsed > overhead? (TIME_MEASURE)((double)elapsed - overhead + 0.5): 0;
+	}
+
+	/**
+	* times loops of counts and of empty timers, against empty loops; every measure keeps the
+	* fastest of a few rounds, which is the least disturbed by the rest of the machine
+	*/
+	static Overhead calibrateOverhead(){
+		const int ROUNDS = 5;
+		const int INCREMENTS = 1000000;
+		const int SCOPES = 20000;
+		Overhead costs = { 0, { 0, 0 }, { 0, 0 } };
+		Profiler scratch("Calibration", costs);
+		OperationCounter op = scratch.createOperation("increment", 0);
+		costs.increment = 1e300;
+		for(int round = 0; round < ROUNDS; ++round){
+			TIME_MEASURE t0 = readTimestamp(STEADY_CLOCK);
+			for(int i = 0; i < INCREMENTS; ++i){
+				op.count();
+				std::atomic_signal_fence(std::memory_order_seq_cst);
+			}
+			TIME_MEASURE t1 = readTimestamp(STEADY_CLOCK);
+			for(int i = 0; i < INCREMENTS; ++i){
+				std::atomic_signal_fence(std::memory_order_seq_cst);
+			}
+			TIME_MEASURE t2 = readTimestamp(STEADY_CLOCK);
+			costs.increment = (std::min)(costs.increment, ((double)(t1 - t0) - (double)(t2 - t1)) / INCREMENTS);
+		}
+		costs.increment = (std::max)(costs.increment, 0.0);
+
+		for(int backend = STEADY_CLOCK; backend <= RDTSC; ++backend){
+			TimerCounter timer = scratch.createTimer("scope", 0, backend);
+			costs.scope[backend] = costs.nested[backend] = 1e300;
+			for(int round = 0; round < ROUNDS; ++round){
+				TIME_MEASURE before = timer.get();
+				TIME_MEASURE t0 = readTimestamp(STEADY_CLOCK);
+				for(int i = 0; i < SCOPES; ++i){
+					timer.start();
+					timer.stop();
+				}
+				TIME_MEASURE t1 = readTimestamp(STEADY_CLOCK);
+				costs.scope[backend] = (std::min)(costs.scope[backend], (double)(timer.get() - before) / SCOPES);
+				costs.nested[backend] = (std::min)(costs.nested[backend], (double)(t1 - t0) / SCOPES);
+			}
+		}
+		return costs;
+	}
+
+	static TIME_MEASURE readTimestamp(int backend){
+#ifdef PROFILER_HAS_RDTSC
+		if(backend == RDTSC){
+			return __rdtsc();
+		}
+#endif
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	/**
+	* number of time stamp counter ticks in a nanosecond, measured once against the steady clock
+	*/
+	static double ticksPerNanosecond(){
+		static const double ticks = calibrateTicks();
+		return ticks;
+	}
+
+	static double calibrateTicks(){
+		TIME_MEASURE clockStart, clockStop, tscStart, tscStop;
+		clockStart = readTimestamp(STEADY_CLOCK);
+		tscStart = readTimestamp(RDTSC);
+		do{
+			clockStop = readTimestamp(STEADY_CLOCK);
+		}while(clockStop - clockStart < 20000000);
+		tscStop = readTimestamp(RDTSC);
+		return (double)(tscStop - tscStart) / (clockStop - clockStart);
+	}
+
+	static TIME_MEASURE elapsedNanoseconds(int backend, TIME_MEASURE start, TIME_MEASURE stop){
+		if(stop < start){
+			return 0;
+		}
+#ifdef PROFILER_HAS_RDTSC
+		if(backend == RDTSC){
+			return (TIME_MEASURE)((stop - start) / ticksPerNanosecond());
+		}
+#endif
+		return stop - start;
+	}
+
+	template <typename T>
+	static void sumSeries(std::vector<SizeTable<T> > &tables, SeriesId newId, SeriesId id1, SeriesId id2){
+		SizeTable<T> sum;
+		if (tables.size() <= (size_t)id1 || tables.size() <= (size_t)id2 ||
+			tables[id1].empty() || tables[id2].empty()){
+				return;
+		}
+		tables[id1].forEach([&](SizeKey size, T &value){
+			T *other = tables[id2].find(size);
+			sum.cell(size) = other? value + *other: value;
+		});
+		if(tables.size() <= (size_t)newId){
+			tables.resize(newId + 1);
+		}
+		tables[newId] = std::move(sum);
+	}
+
+	template <typename T>
+	static void divideSeries(std::vector<SizeTable<T> > &tables, SeriesId series, unsigned int divisor){
+		if (tables.size() > (size_t)series && divisor != 0) {
+			tables[series].forEach([&](SizeKey, T &value){
+				value /= divisor;
+			});
+		}
+	}
+
+	/**
+	* prints the series of a section as "name": [[size, value], ...], ordered by name
+	*/
+	template <typename T>
+	void printSection(FILE *fout, std::vector<SizeTable<T> > &tables){
+		bool hasData, hasSequences = false;
+		std::map<std::string, SeriesId>::const_iterator it;
+		for(it = seriesIds.begin(); it != seriesIds.end(); ++it){
+			if(tables.size() <= (size_t)it->second || tables[it->second].empty()){
+				continue;
+			}
+			fprintf(fout, hasSequences? ",\n\t\t\"": "\t\t\"");
+			hasSequences = true;
+			hasData = false;
+			print_modified(fout, it->first.c_str());
+			fprintf(fout, "\": [");
+			tables[it->second].forEach([&](SizeKey size, T &value){
+				fprintf(fout, hasData? ", [%lld, %llu]": "[%lld, %llu]", size, (unsigned long long)value);
+				hasData = true;
+			});
+			fprintf(fout, "]");
+		}
+		if(hasSequences){
+			fprintf(fout, "\n");
+		}
+	}
+
+	/**
+	* the values of a series, from the first section which has it, in increasing size order
+	*/
+	void seriesPoints(SeriesId id, std::vector<std::pair<SizeKey, double> > &points){
+		if(!tablePoints(ownShard.opcount, id, points) && !tablePoints(ownShard.times, id, points) &&
+			!tablePoints(ownShard.hardware, id, points)){
+			tablePoints(ownShard.memory, id, points);
+		}
+	}
+
+	template <typename T>
+	static bool tablePoints(std::vector<SizeTable<T> > &tables, SeriesId id, std::vector<std::pair<SizeKey, double> > &points){
+		if(tables.size() <= (size_t)id || tables[id].empty()){
+			return false;
+		}
+		tables[id].forEach([&](SizeKey size, T &value){
+			points.push_back(std::make_pair(size, (double)value));
+		});
+		return true;
+	}
+
+	static double modelValue(int model, double n){
+		switch(model){
+		case COMPLEXITY_LOG_N: return log2(n);
+		case COMPLEXITY_N: return n;
+		case COMPLEXITY_N_LOG_N: return n * log2(n);
+		case COMPLEXITY_N2: return n * n;
+		case COMPLEXITY_N3: return n * n * n;
+		default: return 1;
+		}
+	}
+
+	static ComplexityFit fitPoints(const std::vector<std::pair<SizeKey, double> > &points){
+		ComplexityFit best = { COMPLEXITY_1, 0, 0, 0, 0 };
+		double bestError = -1;
+		for(int model = 0; model < COMPLEXITY_MODELS; ++model){
+			double sumX = 0, sumY = 0, sumXX = 0, sumXY = 0;
+			int k = 0;
+			for(size_t i = 0; i < points.size(); ++i){
+				if(points[i].first >= 1){
+					double x = modelValue(model, points[i].first), y = points[i].second;
+					sumX += x;
+					sumY += y;
+					sumXX += x * x;
+					sumXY += x * y;
+					++k;
+				}
+			}
+			if(k == 0){
+				break;
+			}
+			double a = 0, b = sumY / k;
+			double variance = sumXX - sumX * sumX / k;
+			if(model != COMPLEXITY_1){
+				if(k < 2 || variance <= 0){
+					continue;
+				}
+				a = (sumXY - sumX * sumY / k) / variance;
+				b = (sumY - a * sumX) / k;
+				if(a < 0){
+					continue;
+				}
+			}
+			double error = 0;
+			for(size_t i = 0; i < points.size(); ++i){
+				if(points[i].first >= 1){
+					double diff = points[i].second - (a * modelValue(model, points[i].first) + b);
+					error += diff * diff;
+				}
+			}
+			if(bestError < 0 || error < bestError){
+				bestError = error;
+				double mean = fabs(sumY / k);
+				best.model = model;
+				best.a = a;
+				best.b = b;
+				best.residual = mean > 0? sqrt(error / k) / mean: 0;
+				best.points = k;
+			}
+		}
+		return best;
+	}
+
+	static std::vector<double> crossPoints(const std::vector<std::pair<SizeKey, double> > &points1,
+		const std::vector<std::pair<SizeKey, double> > &points2){
+		std::vector<double> sizes;
+		size_t i = 0, j = 0;
+		bool hasPrevious = false;
+		double previousSize = 0, previousDiff = 0;
+		while(i < points1.size() && j < points2.size()){
+			if(points1[i].first < points2[j].first){
+				++i;
+			}else if(points2[j].first < points1[i].first){
+				++j;
+			}else{
+				//sizes where both series are equal are skipped, the crossing is interpolated
+				//between the sizes around them
+				double diff = points1[i].second - points2[j].second;
+				if(diff != 0){
+					if(hasPrevious && (previousDiff < 0) != (diff < 0)){
+						sizes.push_back(previousSize + (points1[i].first - previousSize) * previousDiff / (previousDiff - diff));
+					}
+					hasPrevious = true;
+					previousSize = points1[i].first;
+					previousDiff = diff;
+				}
+				++i;
+				++j;
+			}
+		}
+		return sizes;
+	}
+
+	/**
+	* buffers the exported data and writes it in large blocks to a FILE or a file descriptor
+	*/
+	class ExportWriter{
+		static const size_t BUFFER_SIZE = 1 << 16;
+		FILE *file;
+		int fd;
+		std::vector<char> buffer;
+		size_t used;
+		bool failed;
+	  public:
+		ExportWriter(FILE *givenFile, int givenFd) : file(givenFile), fd(givenFd), buffer(BUFFER_SIZE), used(0), failed(false) {}
+
+		void write(const void *data, size_t length){
+			const char *bytes = (const char*)data;
+			while(length > 0){
+				size_t chunk = length < BUFFER_SIZE - used? length: BUFFER_SIZE - used;
+				memcpy(&buffer[used], bytes, chunk);
+				used += chunk;
+				bytes += chunk;
+				length -= chunk;
+				if(used == BUFFER_SIZE){
+					flush();
+				}
+			}
+		}
+
+		void print(const char *format, ...){
+			char line[512];
+			va_list args;
+			va_start(args, format);
+			int length = vsnprintf(line, sizeof(line), format, args);
+			va_end(args);
+			if(length > 0){
+				write(line, length < (int)sizeof(line)? length: sizeof(line) - 1);
+			}
+		}
+
+		/**
+		* writes a string between double quotes, escaping the quotes as CSV (doubled) or JSON does
+		*/
+		void quoted(const std::string &str, bool json){
+			write("\"", 1);
+			for(size_t i = 0; i < str.size(); ++i){
+				if(str[i] == '"'){
+					write(json? "\\\"": "\"\"", 2);
+				}else if(json && str[i] == '\\'){
+					write("\\\\", 2);
+				}else if(json && (unsigned char)str[i] < 0x20){
+					print("\\u%04x", (unsigned char)str[i]);
+				}else{
+					write(&str[i], 1);
+				}
+			}
+			write("\"", 1);
+		}
+
+		void u8(unsigned int value){
+			unsigned char byte = (unsigned char)value;
+			write(&byte, 1);
+		}
+
+		void u32(unsigned long long value){
+			for(int i = 0; i < 4; ++i){
+				u8((unsigned int)(value >> (8 * i)));
+			}
+		}
+
+		void u64(unsigned long long value){
+			for(int i = 0; i < 8; ++i){
+				u8((unsigned int)(value >> (8 * i)));
+			}
+		}
+
+		void text(const std::string &str){
+			u32(str.size());
+			write(str.data(), str.size());
+		}
+
+		void flush(){
+			size_t done = 0;
+			if(file != NULL){
+				if(fwrite(&buffer[0], 1, used, file) != used || fflush(file) != 0){
+					failed = true;
+				}
+			}else{
+				while(done < used){
+#ifdef _MSC_VER
+					int written = _write(fd, &buffer[done], (unsigned int)(used - done));
+#else
+					ssize_t written = ::write(fd, &buffer[done], used - done);
+#endif
+					if(written <= 0){
+						failed = true;
+						break;
+					}
+					done += written;
+				}
+			}
+			used = 0;
+		}
+
+		bool ok() const { return !failed; }
+	};
+
+	int exportData(ExportWriter &writer, int format){
+		mergeShards();
+		if(format == EXPORT_CSV){
+			writer.print("report,section,series,size,value\n");
+		}else if(format == EXPORT_BINARY){
+			// header: "PRFB", format version, report title
+			writer.write("PRFB", 4);
+			writer.u32(2);
+			writer.text(title);
+		}
+		exportSection(writer, format, "opcount", 0, ownShard.opcount);
+		exportSection(writer, format, "times", 1, ownShard.times);
+		exportSection(writer, format, "hardware", 2, ownShard.hardware);
+		exportSection(writer, format, "memory", 3, ownShard.memory);
+		if(format == EXPORT_BINARY){
+			writer.u8(0xff); // end of the report
+		}
+		writer.flush();
+		return writer.ok()? 0: -1;
+	}
+
+	/**
+	* in binary every series is a record made of: section (1 byte, 0 for opcount, 1 for times,
+	* 2 for hardware, 3 for memory),
+	* name (u32 length and bytes), number of values (u32), then for each value the size (u64,
+	* two's complement) and the value (u64); version 1 had u32 sizes
+	*/
+	template <typename T>
+	void exportSection(ExportWriter &writer, int format, const char *section, int sectionCode, std::vector<SizeTable<T> > &tables){
+		std::map<std::string, SeriesId>::const_iterator it;
+		for(it = seriesIds.begin(); it != seriesIds.end(); ++it){
+			if(tables.size() <= (size_t)it->second || tables[it->second].empty()){
+				continue;
+			}
+			const std::string &name = it->first;
+			if(format == EXPORT_BINARY){
+				writer.u8(sectionCode);
+				writer.text(name);
+				writer.u32(tables[it->second].count());
+			}
+			tables[it->second].forEach([&](SizeKey size, T &value){
+				if(format == EXPORT_CSV){
+					writer.quoted(title, false);
+					writer.print(",%s,", section);
+					writer.quoted(name, false);
+					writer.print(",%lld,%llu\n", size, (unsigned long long)value);
+				}else if(format == EXPORT_JSON_LINES){
+					writer.print("{\"report\": ");
+					writer.quoted(title, true);
+					writer.print(", \"section\": \"%s\", \"series\": ", section);
+					writer.quoted(name, true);
+					writer.print(", \"size\": %lld, \"value\": %llu}\n", size, (unsigned long long)value);
+				}else{
+					writer.u64((unsigned long long)size);
+					writer.u64(value);
+				}
+			});
+		}
+	}
+
+	/**
+	* the values of a run, by section and series name, then by size
+	*/
+	typedef std::map<std::pair<std::string, std::string>, std::map<SizeKey, unsigned long long> > BaselineMap;
+
+	static FILE *openFile(const char *name, const char *mode){
+		FILE *f = NULL;
+#ifdef _MSC_VER
+		fopen_s(&f, name, mode);
+#else
+		f = fopen(name, mode);
+#endif
+		return f;
+	}
+
+	template <typename T>
+	void collectBaseline(std::vector<SizeTable<T> > &tables, const char *section, BaselineMap &values){
+		std::map<std::string, SeriesId>::const_iterator it;
+		for(it = seriesIds.begin(); it != seriesIds.end(); ++it){
+			if(tables.size() <= (size_t)it->second || tables[it->second].empty()){
+				continue;
+			}
+			std::map<SizeKey, unsigned long long> &series = values[std::make_pair(std::string(section), it->first)];
+			tables[it->second].forEach([&](SizeKey size, T &value){
+				series[size] = (unsigned long long)value;
+			});
+		}
+	}
+
+	/**
+	* reads the next field of a CSV row, unquoting it, and moves past the comma
+	*/
+	static std::string csvField(const std::string &line, size_t &pos){
+		std::string field;
+		if(pos < line.size() && line[pos] == '"'){
+			for(++pos; pos < line.size(); ++pos){
+				if(line[pos] == '"'){
+					if(pos + 1 < line.size() && line[pos + 1] == '"'){
+						++pos;
+					}else{
+						++pos;
+						break;
+					}
+				}
+				field += line[pos];
+			}
+		}
+		while(pos < line.size() && line[pos] != ','){
+			field += line[pos++];
+		}
+		++pos;
+		return field;
+	}
+
+	/**
+	* reads a file written by exportData as EXPORT_CSV
+	* returns 0 on success, -1 if the file cannot be opened
+	*/
+	static int readBaseline(const char *fileName, BaselineMap &values){
+		FILE *fin = openFile(fileName, "rb");
+		if(fin == NULL){
+			return -1;
+		}
+		std::string line;
+		bool header = true;
+		int c;
+		do{
+			c = fgetc(fin);
+			if(c != EOF && c != '\n'){
+				if(c != '\r'){
+					line += (char)c;
+				}
+				continue;
+			}
+			if(!header && !line.empty()){
+				size_t pos = 0;
+				csvField(line, pos); // the report title
+				std::string section = csvField(line, pos);
+				std::string series = csvField(line, pos);
+				SizeKey size = strtoll(csvField(line, pos).c_str(), NULL, 10);
+				values[std::make_pair(section, series)][size] = strtoull(csvField(line, pos).c_str(), NULL, 10);
+			}
+			header = false;
+			line.clear();
+		}while(c != EOF);
+		fclose(fin);
+		return 0;
+	}
+
+	static void writeDiffRow(FILE *fout, const std::pair<std::string, std::string> &key, int sizes,
+		unsigned long long oldSum, unsigned long long newSum, double change, const char *status){
+		if(fout == NULL){
+			return;
+		}
+		fprintf(fout, "%s,\"", key.first.c_str());
+		for(size_t i = 0; i < key.second.size(); ++i){
+			if(key.second[i] == '"'){
+				fputc('"', fout);
+			}
+			fputc(key.second[i], fout);
+		}
+		fprintf(fout, "\",%d,%llu,%llu,%.4f,%s\n", sizes, oldSum, newSum, change, status);
+	}
+
+	/**
+	* the journal is a text file of blocks, one per finished point:
+	*     point<TAB>size<TAB>repetition<TAB>title
+	*     value<TAB>section<TAB>value added<TAB>series
+	*     end
+	* a block cut short by an interruption has no end line, and is ignored when read
+	*/
+	int readJournal(const char *fileName){
+		FILE *fin = openFile(fileName, "rb");
+		if(fin == NULL){
+			return 0;
+		}
+		std::string line, pointTitle;
+		std::pair<SizeKey, int> key;
+		JournalPoint point;
+		bool inPoint = false;
+		int loaded = 0;
+		int c;
+		do{
+			c = fgetc(fin);
+			if(c != EOF && c != '\n'){
+				if(c != '\r'){
+					line += (char)c;
+				}
+				continue;
+			}
+			std::vector<std::string> fields;
+			size_t start = 0, tab;
+			while(fields.size() < 3 && (tab = line.find('\t', start)) != std::string::npos){
+				fields.push_back(line.substr(start, tab - start));
+				start = tab + 1;
+			}
+			fields.push_back(line.substr(start));
+			if(fields[0] == "point" && fields.size() == 4){
+				inPoint = true;
+				key = std::make_pair((SizeKey)strtoll(fields[1].c_str(), NULL, 10), atoi(fields[2].c_str()));
+				pointTitle = fields[3];
+				point = JournalPoint();
+			}else if(fields[0] == "value" && fields.size() == 4 && inPoint){
+				JournalValue value;
+				value.section = atoi(fields[1].c_str());
+				value.value = strtoull(fields[2].c_str(), NULL, 10);
+				value.series = internSeries(fields[3].c_str());
+				if(value.section >= 0 && value.section < SECTION_COUNT){
+					point.values.push_back(value);
+				}
+			}else if(fields[0] == "end" && inPoint){
+				journalPoints[pointTitle][key] = point;
+				inPoint = false;
+				++loaded;
+			}
+			line.clear();
+		}while(c != EOF);
+		fclose(fin);
+		return loaded;
+	}
+
+	/**
+	* adds the values of a journal point to the shard, if the journal has it and it was
+	* not given back since the last reset
+	*/
+	bool restorePoint(Shard &shard, SizeKey size, int repetition){
+		if(journal == NULL){
+			return false;
+		}
+		std::lock_guard<std::mutex> lock(journalLock);
+		std::map<std::string, JournalPointMap>::iterator titleIt = journalPoints.find(title);
+		if(titleIt == journalPoints.end()){
+			return false;
+		}
+		JournalPointMap::iterator it = titleIt->second.find(std::make_pair(size, repetition));
+		if(it == titleIt->second.end() || it->second.restored){
+			return false;
+		}
+		it->second.restored = true;
+		for(size_t i = 0; i < it->second.values.size(); ++i){
+			const JournalValue &value = it->second.values[i];
+			if(value.section == OPCOUNT_SECTION){
+				tableCell(shard.opcount, value.series, size) += (OPCOUNT_MEASURE)value.value;
+			}else if(value.section == TIMES_SECTION){
+				tableCell(shard.times, value.series, size) += (TIME_MEASURE)value.value;
+			}else if(value.section == HARDWARE_SECTION){
+				tableCell(shard.hardware, value.series, size) += (HARDWARE_MEASURE)value.value;
+			}else{
+				tableCell(shard.memory, value.series, size) += (MEMORY_MEASURE)value.value;
+			}
+		}
+		return true;
+	}
+
+	void takeJournalSnapshot(Shard &shard, SizeKey size, PointSnapshot &snapshot){
+		if(journal != NULL){
+			takePointSnapshot(shard, size, snapshot);
+		}
+	}
+
+	void takePointSnapshot(Shard &shard, SizeKey size, PointSnapshot &snapshot){
+		snapshotSection(shard.opcount, size, snapshot.values[OPCOUNT_SECTION]);
+		snapshotSection(shard.times, size, snapshot.values[TIMES_SECTION]);
+		snapshotSection(shard.hardware, size, snapshot.values[HARDWARE_SECTION]);
+		snapshotSection(shard.memory, size, snapshot.values[MEMORY_SECTION]);
+	}
+
+	template <typename T>
+	static void snapshotSection(std::vector<SizeTable<T> > &tables, SizeKey size, std::vector<long long> &values){
+		values.assign(tables.size(), -1);
+		for(size_t id = 0; id < tables.size(); ++id){
+			T *value = tables[id].find(size);
+			if(value != NULL){
+				values[id] = (long long)*value;
+			}
+		}
+	}
+
+	/**
+	* gives every series at the size its value in the snapshot back, and 0 to the ones which
+	* did not exist then; those are kept rather than removed, since live counters, timers
+	* and call sites may point to them
+	*/
+	void rollbackPoint(Shard &shard, SizeKey size, const PointSnapshot &before){
+		rollbackSection(shard.opcount, size, before.values[OPCOUNT_SECTION]);
+		rollbackSection(shard.times, size, before.values[TIMES_SECTION]);
+		rollbackSection(shard.hardware, size, before.values[HARDWARE_SECTION]);
+		rollbackSection(shard.memory, size, before.values[MEMORY_SECTION]);
+	}
+
+	template <typename T>
+	static void rollbackSection(std::vector<SizeTable<T> > &tables, SizeKey size, const std::vector<long long> &before){
+		for(size_t id = 0; id < tables.size(); ++id){
+			T *value = tables[id].find(size);
+			long long old = id < before.size()? before[id]: -1;
+			if(value != NULL){
+				*value = old < 0? 0: (T)old;
+			}
+		}
+	}
+
+	/**
+	* the series created or changed at the size since the snapshot, with the value they gained
+	*/
+	template <typename T>
+	static void diffSection(int section, std::vector<SizeTable<T> > &tables, SizeKey size,
+		const std::vector<long long> &before, std::vector<JournalValue> &values){
+		for(size_t id = 0; id < tables.size(); ++id){
+			T *value = tables[id].find(size);
+			long long old = id < before.size()? before[id]: -1;
+			if(value != NULL && (old < 0 || (long long)*value != old)){
+				JournalValue entry;
+				entry.section = section;
+				entry.series = (SeriesId)id;
+				entry.value = (unsigned long long)*value - (old < 0? 0: (unsigned long long)old);
+				values.push_back(entry);
+			}
+		}
+	}
+
+	/**
+	* appends the point to the journal, and flushes it, so it survives an interruption
+	*/
+	void commitPoint(Shard &shard, SizeKey size, int repetition, const PointSnapshot &before){
+		if(journal == NULL){
+			return;
+		}
+		JournalPoint point;
+		diffSection(OPCOUNT_SECTION, shard.opcount, size, before.values[OPCOUNT_SECTION], point.values);
+		diffSection(TIMES_SECTION, shard.times, size, before.values[TIMES_SECTION], point.values);
+		diffSection(HARDWARE_SECTION, shard.hardware, size, before.values[HARDWARE_SECTION], point.values);
+		diffSection(MEMORY_SECTION, shard.memory, size, before.values[MEMORY_SECTION], point.values);
+		point.restored = true;
+
+		std::lock_guard<std::mutex> lock(journalLock);
+		fprintf(journal, "point\t%lld\t%d\t%s\n", size, repetition, title.c_str());
+		for(size_t i = 0; i < point.values.size(); ++i){
+			fprintf(journal, "value\t%d\t%llu\t%s\n", point.values[i].section, point.values[i].value,
+				seriesName(point.values[i].series).c_str());
+		}
+		fprintf(journal, "end\n");
+		fflush(journal);
+		journalPoints[title][std::make_pair(size, repetition)] = point;
+	}
+
+	/**
+	* after a reset every point can be given back again, to the new title's series
+	*/
+	void resetJournal(){
+		std::map<std::string, JournalPointMap>::iterator titleIt;
+		JournalPointMap::iterator it;
+		for(titleIt = journalPoints.begin(); titleIt != journalPoints.end(); ++titleIt){
+			for(it = titleIt->second.begin(); it != titleIt->second.end(); ++it){
+				it->second.restored = false;
+			}
+		}
+		journalPending.clear();
+	}
+
+	std::string seriesName(SeriesId series){
+		std::lock_guard<std::mutex> lock(registryLock);
+		return seriesNames[series];
+	}
+
+	static void warnUnavailable(const PerfEvents &events){
+		static const char *names[PERF_EVENT_COUNT] = {
+			"cycles", "instructions", "L1 data misses", "LLC misses", "branch misses", "dTLB misses"
+		};
+		static bool warned = false;
+		std::string missing;
+		for(int i = 0; i < PERF_EVENT_COUNT; ++i){
+			if(!events.available(i)){
+				missing += missing.empty()? names[i]: std::string(", ") + names[i];
+			}
+		}
+		if(!missing.empty() && !warned){
+			warned = true;
+			fprintf(stderr, "Profiler: hardware counters not available: %s"
+#ifdef __linux__
+				" (check /proc/sys/kernel/perf_event_paranoid)"
+#endif
+				"\n", missing.c_str());
+		}
+	}
+
+	static double elapsedSeconds(std::chrono::steady_clock::time_point begin){
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+	}
+
+	/**
+	* measures one size of adaptiveSweep, keeping sizes sorted and seconds[i] the time the
+	* measurement of sizes[i] took
+	*/
+	template <typename F>
+	void measureAt(SizeKey size, F &measure, std::vector<SizeKey> &sizes, std::vector<double> &seconds){
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		measure(size);
+		size_t at = std::lower_bound(sizes.begin(), sizes.end(), size) - sizes.begin();
+		sizes.insert(sizes.begin() + at, size);
+		seconds.insert(seconds.begin() + at, elapsedSeconds(start));
+	}
+
+	/**
+	* the index of the interval (sizes[i], sizes[i + 1]) which adaptiveSweep should split, or -1
+	* if every interval is already a single step
+	* the score of an interval is its width on a log scale times how interesting it is: how
+	* much a series bends at its ends, on a log-log scale, or for two members of a group 1 if
+	* they cross inside it, otherwise how much the log of their ratio changes
+	*/
+	int refinedInterval(const std::vector<SizeKey> &sizes, const char *group){
+		std::vector<std::vector<double> > curves;
+		std::vector<std::string> names;
+		mergeShards();
+		if(group != NULL && groups.find(group) != groups.end()){
+			names = groups[group];
+		}else{
+			std::map<std::string, SeriesId>::const_iterator it;
+			for(it = seriesIds.begin(); it != seriesIds.end(); ++it){
+				names.push_back(it->first);
+			}
+		}
+		for(size_t i = 0; i < names.size(); ++i){
+			std::vector<std::pair<SizeKey, double> > points;
+			seriesPoints(internSeries(names[i].c_str()), points);
+			std::vector<double> curve(sizes.size(), NAN);
+			size_t found = 0;
+			for(size_t j = 0, k = 0; j < points.size() && k < sizes.size(); ){
+				if(points[j].first < sizes[k]){
+					++j;
+				}else if(points[j].first > sizes[k]){
+					++k;
+				}else{
+					curve[k] = points[j].second > 0? log(points[j].second): NAN;
+					++j;
+					++k;
+					++found;
+				}
+			}
+			if(found >= 2){
+				curves.push_back(curve);
+			}
+		}
+
+		int best = -1;
+		double bestScore = 0;
+		for(size_t i = 0; i + 1 < sizes.size(); ++i){
+			if(sizes[i + 1] - sizes[i] <= 1){
+				continue;
+			}
+			double width = log((double)sizes[i + 1] / sizes[i]);
+			double signal = 0;
+			for(size_t c = 0; c < curves.size(); ++c){
+				signal = (std::max)(signal, (std::max)(curveBend(curves[c], sizes, i), curveBend(curves[c], sizes, i + 1)));
+			}
+			if(group != NULL){
+				for(size_t c = 0; c < curves.size(); ++c){
+					for(size_t d = c + 1; d < curves.size(); ++d){
+						double before = curves[c][i] - curves[d][i], after = curves[c][i + 1] - curves[d][i + 1];
+						if(isnan(before) || isnan(after)){
+							continue;
+						}
+						signal = (std::max)(signal, (before < 0) != (after < 0)? 1.0: fabs(after - before));
+					}
+				}
+			}
+			// even a straight line gets points, where it is sampled the most sparsely
+			double score = (signal + 0.05) * width;
+			if(score > bestScore){
+				bestScore = score;
+				best = (int)i;
+			}
+		}
+		return best;
+	}
+
+	/**
+	* how far the log curve is at sizes[i] from the line through its neighbours on a log-log
+	* scale, 0 at the ends or where it is missing; unlike a change of slope, this does not
+	* grow with the noise when the neighbours get close
+	*/
+	static double curveBend(const std::vector<double> &curve, const std::vector<SizeKey> &sizes, size_t i){
+		if(i == 0 || i + 1 >= sizes.size() || isnan(curve[i - 1]) || isnan(curve[i]) || isnan(curve[i + 1])){
+			return 0;
+		}
+		double t = log((double)sizes[i] / sizes[i - 1]) / log((double)sizes[i + 1] / sizes[i - 1]);
+		return fabs(curve[i] - (curve[i - 1] + t * (curve[i + 1] - curve[i - 1])));
+	}
+
+	/**
+	* the values of a grid, values[row][column] for the y of the row and xs[column], NAN
+	* where the point was not measured
+	*/
+	void gridMatrix(const Grid &grid, std::vector<SizeKey> &xs, std::vector<std::vector<double> > &values){
+		std::vector<std::vector<std::pair<SizeKey, double> > > rows;
+		std::map<double, SeriesId>::const_iterator row;
+		mergeShards();
+		for(row = grid.rows.begin(); row != grid.rows.end(); ++row){
+			rows.push_back(std::vector<std::pair<SizeKey, double> >());
+			seriesPoints(row->second, rows.back());
+			for(size_t i = 0; i < rows.back().size(); ++i){
+				xs.push_back(rows.back()[i].first);
+			}
+		}
+		std::sort(xs.begin(), xs.end());
+		xs.erase(std::unique(xs.begin(), xs.end()), xs.end());
+		values.assign(rows.size(), std::vector<double>(xs.size(), NAN));
+		for(size_t j = 0; j < rows.size(); ++j){
+			for(size_t i = 0; i < rows[j].size(); ++i){
+				size_t column = std::lower_bound(xs.begin(), xs.end(), rows[j][i].first) - xs.begin();
+				values[j][column] = rows[j][i].second;
+			}
+		}
+	}
+
+	/**
+	* "name": {"x": xLabel, "y": yLabel, "xs": [...], "ys": [...], "values": [[...], ...],
+	* "best": [y of the smallest value at every x]}
+	*/
+	void printGrid(FILE *fout, const std::string &name, const Grid &grid, bool first){
+		std::vector<SizeKey> xs;
+		std::vector<std::vector<double> > values;
+		std::map<double, SeriesId>::const_iterator row;
+		gridMatrix(grid, xs, values);
+		fprintf(fout, first? "\n\t\t\"": ",\n\t\t\"");
+		print_modified(fout, name.c_str());
+		fprintf(fout, "\": {\"x\": ");
+		print_escaped(fout, grid.xLabel.c_str());
+		fprintf(fout, ", \"y\": ");
+		print_escaped(fout, grid.yLabel.c_str());
+		fprintf(fout, ", \"xs\": [");
+		for(size_t i = 0; i < xs.size(); ++i){
+			fprintf(fout, i? ", %lld": "%lld", xs[i]);
+		}
+		fprintf(fout, "], \"ys\": [");
+		for(row = grid.rows.begin(); row != grid.rows.end(); ++row){
+			fprintf(fout, row == grid.rows.begin()? "%g": ", %g", row->first);
+		}
+		fprintf(fout, "], \"values\": [");
+		for(size_t j = 0; j < values.size(); ++j){
+			fprintf(fout, j? ", [": "[");
+			for(size_t i = 0; i < xs.size(); ++i){
+				fprintf(fout, i? ", ": "");
+				fprintf(fout, isnan(values[j][i])? "null": "%.6g", values[j][i]);
+			}
+			fprintf(fout, "]");
+		}
+		fprintf(fout, "], \"best\": [");
+		for(size_t i = 0; i < xs.size(); ++i){
+			double best = NAN;
+			row = grid.rows.begin();
+			std::map<double, SeriesId>::const_iterator bestRow = grid.rows.end();
+			for(size_t j = 0; j < values.size(); ++j, ++row){
+				if(!isnan(values[j][i]) && (isnan(best) || values[j][i] < best)){
+					best = values[j][i];
+					bestRow = row;
+				}
+			}
+			fprintf(fout, i? ", ": "");
+			if(bestRow == grid.rows.end()){
+				fprintf(fout, "null");
+			}else{
+				fprintf(fout, "%g", bestRow->first);
+			}
+		}
+		fprintf(fout, "]}");
+	}
+
+	/**
+	* prints str as a quoted JSON string, which can also be placed inside the html
+	*/
+	static void print_escaped(FILE *f, const char *str){
+		fputc('"', f);
+		for(const unsigned char *c = (const unsigned char*)str; *c != 0; ++c){
+			if(*c == '"' || *c == '\\'){
+				fputc('\\', f);
+				fputc(*c, f);
+			}else if(*c < 0x20 || *c == '<' || *c == '>' || *c == '&'){
+				fprintf(f, "\\u%04x", *c);
+			}else{
+				fputc(*c, f);
+			}
+		}
+		fputc('"', f);
+	}
+
+	void print_modified(FILE *f, const char *str){
+		int i = 0;
+		while(str[i] != 0){
+			if(isalnum(str[i]) || str[i] == '_'){
+				fprintf(f, "%c", str[i]);
+			}else{
+				fprintf(f, "_");
+			}
+			++i;
+		}
+	}
+};
+
+typedef Profiler::OperationCounter Operation;
+typedef Profiler::TimerCounter Timer;
+typedef Profiler::PerfCounter PerfCounter;
+typedef Profiler::AllocationCounter AllocationCounter;
+
+#ifdef PROFILER_TRACK_ALLOCATIONS
+/**
+* the allocation hooks, compiled in the single translation unit which defines
+* PROFILER_TRACK_ALLOCATIONS; every allocation is counted in the thread which makes it
+*/
+#   if defined(__GLIBC__)
+extern "C" {
+void *__libc_malloc(size_t size);
+void *__libc_calloc(size_t count, size_t size);
+void *__libc_realloc(void *ptr, size_t size);
+void __libc_free(void *ptr);
+
+//operator new of libstdc++ allocates through malloc, so it is counted here as well
+void *malloc(size_t size) throw() {
+	void *ptr = __libc_malloc(size);
+	if(ptr != NULL){
+		Profiler::recordAllocation(malloc_usable_size(ptr));
+	}
+	return ptr;
+}
+
+void *calloc(size_t count, size_t size) throw() {
+	void *ptr = __libc_calloc(count, size);
+	if(ptr != NULL){
+		Profiler::recordAllocation(malloc_usable_size(ptr));
+	}
+	return ptr;
+}
+
+void *realloc(void *ptr, size_t size) throw() {
+	size_t oldSize = ptr != NULL? malloc_usable_size(ptr): 0;
+	void *newPtr = __libc_realloc(ptr, size);
+	if(newPtr != NULL || size == 0){
+		Profiler::recordFree(oldSize);
+	}
+	if(newPtr != NULL){
+		Profiler::recordAllocation(malloc_usable_size(newPtr));
+	}
+	return newPtr;
+}
+
+void free(void *ptr) throw() {
+	if(ptr != NULL){
+		Profiler::recordFree(malloc_usable_size(ptr));
+	}
+	__libc_free(ptr);
+}
+}
+#   elif defined(_MSC_VER)
+void *operator new(size_t size) {
+	void *ptr = malloc(size == 0? 1: size);
+	if(ptr == NULL){
+		throw std::bad_alloc();
+	}
+	Profiler::recordAllocation(_msize(ptr));
+	return ptr;
+}
+
+void *operator new[](size_t size) {
+	return operator new(size);
+}
+
+void *operator new(size_t size, const std::nothrow_t&) noexcept {
+	void *ptr = malloc(size == 0? 1: size);
+	if(ptr != NULL){
+		Profiler::recordAllocation(_msize(ptr));
+	}
+	return ptr;
+}
+
+void *operator new[](size_t size, const std::nothrow_t &tag) noexcept {
+	return operator new(size, tag);
+}
+
+void operator delete(void *ptr) noexcept {
+	if(ptr != NULL){
+		Profiler::recordFree(_msize(ptr));
+		free(ptr);
+	}
+}
+
+void operator delete[](void *ptr) noexcept {
+	operator delete(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept {
+	operator delete(ptr);
+}
+
+void operator delete[](void *ptr, size_t) noexcept {
+	operator delete(ptr);
+}
+#   endif
+
+#   if defined(__GLIBC__) || defined(_MSC_VER)
+static struct ProfilerAllocationHooks{
+	ProfilerAllocationHooks() { Profiler::allocationHooksInstalled() = true; }
+} profilerAllocationHooks;
+#   endif
+#endif
+
+/**
+* an operation that counts nothing
+* algorithms taking their operation type as a template parameter can be instantiated
+* with it to run without any instrumentation, every call compiles away
+*/
+class NullOperation{
+public:
+	void count(long long = 1) {}
+	unsigned long long get() const { return 0; }
+	NullOperation local() const { return *this; }
+};
+
+/**
+* a level of a simulated cache: its size and line size in bytes, and how many lines a set holds
+*/
+struct CacheLevel{
+	size_t size;
+	size_t line;
+	size_t ways;
+};
+
+/**
+* a hierarchy of set associative caches with least recently used replacement, which counts
+* the misses of every level for the accesses given to it; a line missing from a level is
+* brought into it and into all the levels above, as in a non-exclusive hierarchy
+* the results only depend on the addresses, not on the machine the program runs on
+*/
+class CacheSimulator{
+	struct Level{
+		CacheLevel config;
+		size_t sets;
+		std::vector<unsigned long long> tags; // ways per set, the most recently used first
+		std::vector<unsigned int> used;
+		unsigned long long misses;
+	};
+	std::vector<Level> levels;
+	unsigned long long accessCount;
+public:
+	/**
+	* 32 KiB 8-way L1, 256 KiB 8-way L2 and 8 MiB 16-way LLC, with 64 byte lines
+	*/
+	CacheSimulator() : accessCount(0) {
+		CacheLevel defaults[] = { {32 << 10, 64, 8}, {256 << 10, 64, 8}, {8 << 20, 64, 16} };
+		for(int i = 0; i < 3; ++i){
+			addLevel(defaults[i]);
+		}
+	}
+
+	explicit CacheSimulator(const std::vector<CacheLevel> &config) : accessCount(0) {
+		for(size_t i = 0; i < config.size(); ++i){
+			addLevel(config[i]);
+		}
+	}
+
+	/**
+	* simulates an access to bytes starting at address, one per cache line it touches
+	*/
+	void access(const void *address, size_t bytes = 1){
+		if(levels.empty()){
+			return;
+		}
+		size_t line = levels[0].config.line;
+		unsigned long long first = (unsigned long long)(size_t)address / line;
+		unsigned long long last = ((unsigned long long)(size_t)address + (bytes > 0? bytes - 1: 0)) / line;
+		for(unsigned long long l = first; l <= last; ++l){
+			++accessCount;
+			unsigned long long byteAddress = l * line;
+			for(size_t i = 0; i < levels.size() && !lookup(levels[i], byteAddress / levels[i].config.line); ++i){
+				++levels[i].misses;
+			}
+		}
+	}
+
+	int levelCount() const { return (int)levels.size(); }
+	unsigned long long accesses() const { return accessCount; }
+	unsigned long long misses(int level) const { return levels[level].misses; }
+
+	/**
+	* empties the caches and the counters
+	*/
+	void reset(){
+		accessCount = 0;
+		for(size_t i = 0; i < levels.size(); ++i){
+			std::fill(levels[i].used.begin(), levels[i].used.end(), 0);
+			levels[i].misses = 0;
+		}
+	}
+private:
+	void addLevel(const CacheLevel &config){
+		Level level;
+		level.config = config;
+		level.config.line = (std::max)((size_t)1, config.line);
+		level.config.ways = (std::max)((size_t)1, config.ways);
+		level.sets = (std::max)((size_t)1, config.size / (level.config.line * level.config.ways));
+		level.tags.resize(level.sets * level.config.ways);
+		level.used.resize(level.sets, 0);
+		level.misses = 0;
+		levels.push_back(level);
+	}
+
+	/**
+	* returns true on a hit; either way the line ends up first in its set
+	*/
+	static bool lookup(Level &level, unsigned long long line){
+		size_t set = (size_t)(line % level.sets);
+		unsigned long long *ways = &level.tags[set * level.config.ways];
+		unsigned int &used = level.used[set];
+		for(unsigned int i = 0; i < used; ++i){
+			if(ways[i] == line){
+				std::rotate(ways, ways + i, ways + i + 1);
+				return true;
+			}
+		}
+		if(used < level.config.ways){
+			++used;
+		}
+		std::copy_backward(ways, ways + used - 1, ways + used);
+		ways[0] = line;
+		return false;
+	}
+};
+
+/**
+* the counters Counted elements report to, set for the calling thread by a CountedScope
+*/
+struct CountedContext{
+	Operation reads;
+	Operation assignments;
+	Operation comparisons;
+	Operation swaps;
+	Operation total;
+	bool paused;
+	CacheSimulator *cache;
+};
+
+inline CountedContext *&countedContext(){
+	static thread_local CountedContext *context = NULL;
+	return context;
+}
+
+/**
+* simulates an access to memory in the cache of the current CountedScope, if it has one,
+* for the accesses which are not made through Counted elements (list nodes, for example)
+*/
+inline void CountedAccess(const void *address, size_t bytes){
+	CountedContext *context = countedContext();
+	if(context != NULL && !context->paused && context->cache != NULL){
+		context->cache->access(address, bytes);
+	}
+}
+
+/**
+* while it exists, the Counted elements used by the calling thread count into the series
+* <name>_reads, <name>_assignments, <name>_comparisons, <name>_swaps and <name>, the total
+* of comparisons and assignments as the labs count them by hand (a swap being 3 assignments)
+* given a CacheSimulator, every access to a Counted element goes through it as well, and the
+* misses of its levels are added to <name>_l1_misses, <name>_l2_misses, ... and <name>_llc_misses
+* (the last level); the simulator is not emptied, so the scopes using it share its contents
+*/
+class CountedScope{
+	CountedContext context;
+	CountedContext *previous;
+	std::vector<Operation> misses;
+	std::vector<unsigned long long> startMisses;
+public:
+	CountedScope(Profiler &profiler, const char *name, Profiler::SizeKey size, CacheSimulator *cache = NULL)
+		: context(makeContext(profiler, name, size, cache)), previous(countedContext()) {
+		if(cache != NULL){
+			for(int level = 0; level < cache->levelCount(); ++level){
+				std::string series = std::string(name) + (level == cache->levelCount() - 1 && level > 0?
+					std::string("_llc_misses"): "_l" + std::to_string(level + 1) + "_misses");
+				misses.push_back(profiler.createOperation(series.c_str(), size));
+				startMisses.push_back(cache->misses(level));
+			}
+		}
+		countedContext() = &context;
+	}
+
+	~CountedScope(){
+		countedContext() = previous;
+		for(size_t level = 0; level < misses.size(); ++level){
+			misses[level].count(context.cache->misses((int)level) - startMisses[level]);
+		}
+	}
+private:
+	CountedScope(const CountedScope&);
+	CountedScope &operator=(const CountedScope&);
+
+	static CountedContext makeContext(Profiler &profiler, const char *name, Profiler::SizeKey size, CacheSimulator *cache){
+		std::string prefix(name);
+		CountedContext created = {
+			profiler.createOperation((prefix + "_reads").c_str(), size),
+			profiler.createOperation((prefix + "_assignments").c_str(), size),
+			profiler.createOperation((prefix + "_comparisons").c_str(), size),
+			profiler.createOperation((prefix + "_swaps").c_str(), size),
+			profiler.createOperation(name, size),
+			false,
+			cache
+		};
+		return created;
+	}
+};
+
+/**
+* an element which counts what is done with it: conversions to T are reads, copies and
+* assignments are assignments, comparisons are comparisons, and swap counts one swap and
+* its 3 assignments; nothing is counted outside a CountedScope
+*/
+template <typename T>
+class Counted{
+	T value;
+
+	static CountedContext *active(){
+		CountedContext *context = countedContext();
+		return context != NULL && !context->paused? context: NULL;
+	}
+
+	/**
+	* an assignment to to, from from if it is an element too
+	*/
+	static void countAssignment(const Counted *to, const Counted *from = NULL){
+		CountedContext *context = active();
+		if(context != NULL){
+			context->assignments.count();
+			context->total.count();
+			if(context->cache != NULL){
+				if(from != NULL){
+					context->cache->access(&from->value, sizeof(T));
+				}
+				context->cache->access(&to->value, sizeof(T));
 			}
-			fprintf(fout, "],\n");
-		}
-		if(hasSequences){
-			fseek(fout, -(int)(strlen("\n") + 1), SEEK_CUR);
-			fprintf(fout, "\n");
 		}
-		
-        fprintf(fout, "\t},\n\t\"groups\": {\n");
-		//next show the groups
-		hasSequences = false;
-		GroupMap::const_iterator git1;
-		std::vector<std::string>::const_iterator git2;
-		for(git1 = groups.begin(); git1 != groups.end(); ++git1){
-			hasSequences = true;
-			hasData = false;
-			fprintf(fout, "\t\t\"");
-			print_modified(fout, git1->first.c_str());
-			fprintf(fout, "\": [");
-			for(git2 = git1->second.begin(); git2 != git1->second.end(); ++git2){
-				hasData = true;
-				fprintf(fout, "\"");
-				print_modified(fout, git2->c_str());
-				fprintf(fout, "\", ");
+	}
+
+	static void countComparison(const Counted *a, const Counted *b = NULL){
+		CountedContext *context = active();
+		if(context != NULL){
+			context->comparisons.count();
+			context->total.count();
+			if(context->cache != NULL){
+				context->cache->access(&a->value, sizeof(T));
+				if(b != NULL){
+					context->cache->access(&b->value, sizeof(T));
+				}
 			}
-			if(hasData){
-				fseek(fout, -2, SEEK_CUR);
+		}
+	}
+public:
+	Counted() : value() {}
+	Counted(const T &v) : value(v) { countAssignment(this); }
+	Counted(const Counted &other) : value(other.value) { countAssignment(this, &other); }
+
+	Counted &operator=(const Counted &other){
+		value = other.value;
+		countAssignment(this, &other);
+		return *this;
+	}
+
+	Counted &operator=(const T &v){
+		value = v;
+		countAssignment(this);
+		return *this;
+	}
+
+	operator const T&() const {
+		CountedContext *context = active();
+		if(context != NULL){
+			context->reads.count();
+			if(context->cache != NULL){
+				context->cache->access(&value, sizeof(T));
 			}
-			fprintf(fout, "],\n");
 		}
-		if(hasSequences){
-			fseek(fout, -(int)(strlen("\n") + 1), SEEK_CUR);
-			fprintf(fout, "\n");
+		return value;
+	}
+
+	/**
+	* the value, without counting a read
+	*/
+	const T &raw() const { return value; }
+
+	friend bool operator<(const Counted &a, const Counted &b) { countComparison(&a, &b); return a.value < b.value; }
+	friend bool operator<(const Counted &a, const T &b) { countComparison(&a); return a.value < b; }
+	friend bool operator<(const T &a, const Counted &b) { countComparison(&b); return a < b.value; }
+	friend bool operator>(const Counted &a, const Counted &b) { countComparison(&a, &b); return b.value < a.value; }
+	friend bool operator>(const Counted &a, const T &b) { countComparison(&a); return b < a.value; }
+	friend bool operator>(const T &a, const Counted &b) { countComparison(&b); return b.value < a; }
+	friend bool operator<=(const Counted &a, const Counted &b) { countComparison(&a, &b); return !(b.value < a.value); }
+	friend bool operator<=(const Counted &a, const T &b) { countComparison(&a); return !(b < a.value); }
+	friend bool operator<=(const T &a, const Counted &b) { countComparison(&b); return !(b.value < a); }
+	friend bool operator>=(const Counted &a, const Counted &b) { countComparison(&a, &b); return !(a.value < b.value); }
+	friend bool operator>=(const Counted &a, const T &b) { countComparison(&a); return !(a.value < b); }
+	friend bool operator>=(const T &a, const Counted &b) { countComparison(&b); return !(a < b.value); }
+	friend bool operator==(const Counted &a, const Counted &b) { countComparison(&a, &b); return a.value == b.value; }
+	friend bool operator==(const Counted &a, const T &b) { countComparison(&a); return a.value == b; }
+	friend bool operator==(const T &a, const Counted &b) { countComparison(&b); return a == b.value; }
+	friend bool operator!=(const Counted &a, const Counted &b) { countComparison(&a, &b); return !(a.value == b.value); }
+	friend bool operator!=(const Counted &a, const T &b) { countComparison(&a); return !(a.value == b); }
+	friend bool operator!=(const T &a, const Counted &b) { countComparison(&b); return !(a == b.value); }
+
+	friend void swap(Counted &a, Counted &b){
+		CountedContext *context = active();
+		if(context != NULL){
+			context->swaps.count();
+			context->assignments.count(3);
+			context->total.count(3);
+			if(context->cache != NULL){
+				context->cache->access(&a.value, sizeof(T));
+				context->cache->access(&b.value, sizeof(T));
+			}
 		}
-		fprintf(fout, "\t}\n}\n");
-		fwrite(HtmlGen::htmlLast, 1, sizeof(HtmlGen::htmlLast)/sizeof(HtmlGen::htmlLast[0]), fout);
-		fclose(fout);
+		std::swap(a.value, b.value);
+	}
+};
 
-#ifdef _MSC_VER
-		ShellExecuteA(NULL, "open", reportName, NULL, NULL, SW_SHOW);
-#endif
-		return 0;
+/**
+* gives an array of T to an algorithm as Counted<T> elements, through begin() and end()
+* or operator[], and copies the result back when destroyed; the copies are not counted
+*/
+template <typename T>
+class CountedSpan{
+	T *data;
+	std::vector<Counted<T> > elements;
+public:
+	CountedSpan(T *data, size_t size) : data(data) {
+		Pause pause;
+		elements.assign(data, data + size);
 	}
 
+	~CountedSpan(){
+		Pause pause;
+		for(size_t i = 0; i < elements.size(); ++i){
+			data[i] = elements[i].raw();
+		}
+	}
+
+	Counted<T> *begin() { return elements.data(); }
+	Counted<T> *end() { return elements.data() + elements.size(); }
+	Counted<T> &operator[](size_t index) { return elements[index]; }
+	size_t size() const { return elements.size(); }
 private:
-	typedef unsigned int OPCOUNT_MEASURE;
+	CountedSpan(const CountedSpan&);
+	CountedSpan &operator=(const CountedSpan&);
+
+	struct Pause{
+		CountedContext *context;
+		Pause() : context(countedContext()) {
+			if(context != NULL){
+				context->paused = true;
+			}
+		}
+		~Pause(){
+			if(context != NULL){
+				context->paused = false;
+			}
+		}
+	};
+};
+
+/**
+* what a DepthScope collected, indexed by recursion depth, the outermost call being depth 1
+* ops and nanoseconds are those of the call itself, without the calls it made
+*/
+struct DepthRecord{
+	int baseDepth;
+	int maxDepth;
+	std::vector<unsigned long long> calls, ops, nanoseconds;
+};
+
+/**
+* the recursion of one thread: its depth, the record of the active DepthScope, and the
+* calls recorded in it which have not returned yet
+*/
+struct DepthState{
+	struct Frame{
+		unsigned long long startOps, startTime, childOps, childTime;
+	};
+	int depth;
+	DepthRecord *record;
+	std::vector<Frame> frames;
+};
 
-	typedef std::map<int, OPCOUNT_MEASURE> OpcountSequence;
-	typedef std::map<std::string, OpcountSequence> OpcountMap;
+inline DepthState &depthState(){
+	static thread_local DepthState state = { 0, NULL, std::vector<DepthState::Frame>() };
+	return state;
+}
 
-	typedef std::map<std::string, std::vector<std::string> > GroupMap;
+inline const Operation *DepthOperation(const Operation &op) { return &op; }
 
+template <typename Counter>
+	const Operation *DepthOperation(const Counter &) { return NULL; }
+
+/**
+* marks a recursive call, for as long as it runs:
+*     DepthGuard guard(Op);
+* at the start of the function; the guard keeps the recursion depth of the thread, and
+* inside a DepthScope it records the call, the operations Op counted during it (if Op is
+* an Operation) and its time at its depth
+* a guard given a NullOperation does nothing, so an uninstrumented run does not pay for it
+*/
+class DepthGuard{
+	const Operation *op;
+	bool recorded;
+	bool active;
 public:
-	class OperationCounter{
-		OpcountSequence::iterator ptrInMap;
-		Profiler &profiler;
-		friend class Profiler;
-		OperationCounter(Profiler &prof, const char *name, int size) : profiler(prof) {
-			profiler.opcountMap[name][size]; // force creation
-			ptrInMap = profiler.opcountMap[name].find(size);
+	DepthGuard() : op(NULL), active(true) { enter(); }
+
+	template <typename Counter>
+	explicit DepthGuard(const Counter &counter) : op(DepthOperation(counter)), active(true) { enter(); }
+
+	explicit DepthGuard(const NullOperation &) : op(NULL), recorded(false), active(false) {}
+
+	~DepthGuard(){
+		if(!active){
+			return;
 		}
-	  public:
-		void count(int increment=1) { ptrInMap->second += increment; }
-		int get() const { return ptrInMap->second; }
-	};
-	
-	OperationCounter createOperation(const char *name, int size) {
-		return OperationCounter(*this, name, size);
+		DepthState &state = depthState();
+		if(recorded && state.record != NULL){
+			DepthState::Frame frame = state.frames.back();
+			state.frames.pop_back();
+			unsigned long long ops = op != NULL? (unsigned long long)op->get() - frame.startOps: 0;
+			unsigned long long time = depthClock() - frame.startTime;
+			int level = state.depth - state.record->baseDepth;
+			state.record->ops[level] += ops - frame.childOps;
+			state.record->nanoseconds[level] += time - frame.childTime;
+			if(!state.frames.empty()){
+				state.frames.back().childOps += ops;
+				state.frames.back().childTime += time;
+			}
+		}
+		--state.depth;
 	}
 
+	/**
+	* the recursion depth of the calling thread
+	*/
+	static int depth() { return depthState().depth; }
 private:
-	std::string title;
-	OpcountMap opcountMap;
-	GroupMap groups;
+	DepthGuard(const DepthGuard&);
+	DepthGuard &operator=(const DepthGuard&);
 
-	void print_modified(FILE *f, const char *str){
-		int i = 0;
-		while(str[i] != 0){
-			if(isalnum(str[i]) || str[i] == '_'){
-				fprintf(f, "%c", str[i]);
-			}else{
-				fprintf(f, "_");
+	void enter(){
+		DepthState &state = depthState();
+		++state.depth;
+		DepthRecord *record = state.record;
+		recorded = record != NULL;
+		if(recorded){
+			int level = state.depth - record->baseDepth;
+			if(level >= (int)record->calls.size()){
+				record->calls.resize(level + 1, 0);
+				record->ops.resize(level + 1, 0);
+				record->nanoseconds.resize(level + 1, 0);
 			}
-			++i;
+			++record->calls[level];
+			record->maxDepth = (std::max)(record->maxDepth, level);
+			DepthState::Frame frame = { op != NULL? (unsigned long long)op->get(): 0, 0, 0, 0 };
+			frame.startTime = depthClock();
+			state.frames.push_back(frame);
 		}
 	}
+
+	static unsigned long long depthClock(){
+		return (unsigned long long)std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
 };
 
-typedef Profiler::OperationCounter Operation;
+/**
+* records the DepthGuards of the calling thread until it is destroyed, then adds to the profiler:
+* <name>_max_depth at size, the deepest call
+* <name>_calls_at_depth, <name>_ops_at_depth and <name>_time_at_depth, with the depth in
+* place of the size, so their charts are histograms; scopes of the same name add up, so
+* give every size its own name to see its histogram alone, or leave the histograms out
+* of a sweep over sizes with histograms = false
+*/
+class DepthScope{
+	Profiler &profiler;
+	std::string name;
+	Profiler::SizeKey size;
+	bool histograms;
+	DepthRecord record;
+	DepthRecord *previous;
+	std::vector<DepthState::Frame> previousFrames;
+public:
+	DepthScope(Profiler &profiler, const char *name, Profiler::SizeKey size, bool histograms = true)
+		: profiler(profiler), name(name), size(size), histograms(histograms), previous(depthState().record) {
+		DepthState &state = depthState();
+		record.baseDepth = state.depth;
+		record.maxDepth = 0;
+		previousFrames.swap(state.frames);
+		state.record = &record;
+	}
+
+	~DepthScope(){
+		DepthState &state = depthState();
+		state.record = previous;
+		state.frames.swap(previousFrames);
+		profiler.createOperation((name + "_max_depth").c_str(), size).count(record.maxDepth);
+		for(int level = 1; histograms && level < (int)record.calls.size(); ++level){
+			profiler.createOperation((name + "_calls_at_depth").c_str(), level).count(record.calls[level]);
+			profiler.createOperation((name + "_ops_at_depth").c_str(), level).count(record.ops[level]);
+			profiler.addTime((name + "_time_at_depth").c_str(), level, record.nanoseconds[level]);
+		}
+	}
+private:
+	DepthScope(const DepthScope&);
+	DepthScope &operator=(const DepthScope&);
+};
+
+/**
+* stops the DepthScope of the calling thread from recording while it exists, for calls
+* made inside the scope which should not count in it
+*/
+class DepthPause{
+	DepthRecord *record;
+public:
+	DepthPause() : record(depthState().record) { depthState().record = NULL; }
+	~DepthPause() { depthState().record = record; }
+private:
+	DepthPause(const DepthPause&);
+	DepthPause &operator=(const DepthPause&);
+};
 
 enum SortMethod { UNSORTED=0, ASCENDING=1, DESCENDING=2 };
+
+/**
+* picks size distinct numbers from [0, range) and passes them to put(position, number),
+* in ascending order if sorted is set and in random order otherwise, in O(size) expected
+* time when unsorted: a partial Fisher-Yates shuffle when the range is small, and when it
+* is large, random draws skipping the ones already in a hash set (which is rarely needed,
+* and gives the numbers in random order)
+*/
+template <typename F>
+	void SampleUnique(RandomGenerator &rng, unsigned long long range, size_t size, bool sorted, F put){
+		if(sorted && range <= 32ULL * size){
+			//selection sampling (Knuth), already in ascending order
+			size_t pos = 0;
+			for(unsigned long long i = 0; i < range && pos < size; ++i){
+				if(rng.below(range - i) < (unsigned long long)(size - pos)){
+					put(pos++, i);
+				}
+			}
+		}else if(range <= 4ULL * size){
+			std::vector<unsigned long long> numbers((size_t)range);
+			for(size_t i = 0; i < numbers.size(); ++i){
+				numbers[i] = i;
+			}
+			for(size_t i = 0; i < size; ++i){
+				std::swap(numbers[i], numbers[i + (size_t)rng.below(range - i)]);
+				put(i, numbers[i]);
+			}
+		}else{
+			//open addressing, at most half full; no number is ~0 since range < 2^64
+			const unsigned long long EMPTY = ~0ULL;
+			int bits = 1;
+			while((1ULL << bits) < 2ULL * size){
+				++bits;
+			}
+			std::vector<unsigned long long> table((size_t)1 << bits, EMPTY);
+			std::vector<unsigned long long> picked(sorted? size: 0);
+			for(size_t i = 0; i < size; ){
+				unsigned long long number = rng.below(range);
+				size_t slot = (size_t)((number * 0x9e3779b97f4a7c15ULL) >> (64 - bits));
+				while(table[slot] != EMPTY && table[slot] != number){
+					slot = (slot + 1) & (table.size() - 1);
+				}
+				if(table[slot] == number){
+					continue;
+				}
+				table[slot] = number;
+				if(sorted){
+					picked[i] = number;
+				}else{
+					put(i, number);
+				}
+				++i;
+			}
+			if(sorted){
+				std::sort(picked.begin(), picked.end());
+				for(size_t i = 0; i < size; ++i){
+					put(i, picked[i]);
+				}
+			}
+		}
+	}
+
+/**
+* calls f(chunk) for every chunk in [0, chunks), on the given number of threads
+*/
+template <typename F>
+	void ForEachChunk(size_t chunks, int threads, F f){
+		std::atomic<size_t> next(0);
+		auto work = [&](){
+			size_t chunk;
+			while((chunk = next++) < chunks){
+				f(chunk);
+			}
+		};
+		std::vector<std::thread> workers;
+		for(int t = 1; t < threads; ++t){
+			workers.push_back(std::thread(work));
+		}
+		work();
+		for(size_t t = 0; t < workers.size(); ++t){
+			workers[t].join();
+		}
+	}
+
 /**
 * fills the given array with random elements in the given range.
 * optionally, the array can be unique or sorted in ascending (1) or descending (2) order
+* the numbers come from the stream of the calling thread (see SeedRandom); large arrays
+* which need not be unique are filled in parallel, in chunks with their own streams, so
+* the result does not depend on the number of threads; unique ones are picked by the
+* calling thread alone, and so is everything inside a sweep spread over several threads
 */
 template <typename T>
-	void FillRandomArray(T *arr, int size, T range_min=10, T range_max=50000, bool unique = false, int sorted=UNSORTED){
-		int i, pos, extendedSize;
+	void FillRandomArray(T *arr, size_t size, T range_min=10, T range_max=50000, bool unique = false, int sorted=UNSORTED){
+		const size_t CHUNK_SIZE = 1 << 16;
+		const size_t PARALLEL_SIZE = 1 << 20;
 		bool discreteType = true;
 		T interval_len = range_max - range_min + 1;
-		int idx1, idx2;
-		T aux;
-		static bool seeded = false;
-
-		if(!seeded){
-			srand((unsigned int)time(NULL));
-			seeded = true;
-		}
+		RandomGenerator &rng = ThreadRandom();
 
 		if(range_min >= range_max){
 			throw "empty range";
@@ -11356,70 +15571,282 @@ template <typename T>
 		if(typeid(T) == typeid(double) || typeid(T) == typeid(float)){
 			discreteType = false;
 		}
+		//the number of distinct values, computed without overflowing T
+		unsigned long long range = (unsigned long long)((long long)range_max - (long long)range_min) + 1;
 		if(!unique){
-			//no worries
-			for(i=0; i<size; ++i){
-				if(discreteType){
-					arr[i] = range_min + (rand() % int(interval_len));
-				}else{
-					arr[i] = range_min + ((T)(rand()) / RAND_MAX) * (interval_len - 1);
+			unsigned long long base = rng.next();
+			size_t chunks = (size + CHUNK_SIZE - 1) / CHUNK_SIZE;
+			int threads = size >= PARALLEL_SIZE && !InParallelSweep()?
+				(int)(std::min)(chunks, (size_t)std::thread::hardware_concurrency()): 1;
+			if(sorted != UNSORTED){
+				//sorted uniform numbers from the sums of exponential gaps, in O(size) and with the
+				//same distribution as sorting independent ones; every chunk draws its gaps twice
+				//from its own stream, first to sum them, then to place its numbers after the sum of
+				//the chunks before it, which the last number of that chunk is exactly equal to
+				std::vector<double> offsets(chunks + 1, 0);
+				ForEachChunk(chunks, threads, [&](size_t chunk){
+					RandomGenerator chunkRng(base + (unsigned long long)chunk * 0x9e3779b97f4a7c15ULL);
+					size_t end = (std::min)(size, (chunk + 1) * CHUNK_SIZE);
+					double sum = 0;
+					for(size_t i = chunk * CHUNK_SIZE; i < end; ++i){
+						sum -= log(1 - chunkRng.uniform());
+					}
+					offsets[chunk + 1] = sum;
+				});
+				for(size_t chunk = 0; chunk < chunks; ++chunk){
+					offsets[chunk + 1] = offsets[chunk] + offsets[chunk + 1];
 				}
+				double total = offsets[chunks] - log(1 - rng.uniform());
+				ForEachChunk(chunks, threads, [&](size_t chunk){
+					RandomGenerator chunkRng(base + (unsigned long long)chunk * 0x9e3779b97f4a7c15ULL);
+					size_t end = (std::min)(size, (chunk + 1) * CHUNK_SIZE);
+					double sum = 0;
+					for(size_t i = chunk * CHUNK_SIZE; i < end; ++i){
+						sum -= log(1 - chunkRng.uniform());
+						double u = (offsets[chunk] + sum) / total;
+						size_t pos = sorted == ASCENDING? i: size - 1 - i;
+						if(discreteType){
+							arr[pos] = (T)((long long)range_min + (long long)(std::min)((unsigned long long)(u * range), range - 1));
+						}else{
+							arr[pos] = range_min + (T)u * (interval_len - 1);
+						}
+					}
+				});
+				return;
 			}
-			if(sorted == ASCENDING){
-				std::sort(arr, arr + size);
-			}else if(sorted == DESCENDING){
-				std::sort(arr, arr + size, std::greater<T>());
-			}
+			ForEachChunk(chunks, threads, [&](size_t chunk){
+				RandomGenerator chunkRng(base + (unsigned long long)chunk * 0x9e3779b97f4a7c15ULL);
+				size_t end = (std::min)(size, (chunk + 1) * CHUNK_SIZE);
+				for(size_t i = chunk * CHUNK_SIZE; i < end; ++i){
+					if(discreteType){
+						arr[i] = (T)((long long)range_min + (long long)chunkRng.below(range));
+					}else{
+						arr[i] = range_min + (T)chunkRng.uniform() * (interval_len - 1);
+					}
+				}
+			});
 		}else{
-			//use Knuth approach
+			bool ascending = sorted != UNSORTED;
 			if(discreteType){
-				if(interval_len < size){
+				if(range < (unsigned long long)size){
 					throw "range too small";
 				}
-				pos = 0;
-				for(i=0; i<=interval_len && pos<size; ++i){
-					if(rand() % (int(interval_len) - i) < (size - pos)){
-						arr[pos++] = range_min + i;
-					}
-				}
+				SampleUnique(rng, range, size, ascending, [&](size_t pos, unsigned long long number){
+					arr[sorted == DESCENDING? size - 1 - pos: pos] = (T)((long long)range_min + (long long)number);
+				});
 			}else{
-				//use the same approach as above, pick integers from 0 to 17*size
-				extendedSize = 17 * size;
-				pos = 0;
-				for(i=0; i<=extendedSize && pos<size; ++i){
-					if(rand() % (extendedSize - i) < (size - pos)){
-						arr[pos++] = range_min + ((T)i / extendedSize) * (interval_len - 1);
-					}
-				}
+				//pick integers from 0 to 17*size, spread over the interval
+				unsigned long long extendedSize = 17ULL * size;
+				SampleUnique(rng, extendedSize, size, ascending, [&](size_t pos, unsigned long long number){
+					arr[sorted == DESCENDING? size - 1 - pos: pos] = range_min + ((T)number / extendedSize) * (interval_len - 1);
+				});
+			}
+		}
+	}
+
+/**
+* the shapes of input FillDistribution can generate, besides the ones of FillRandomArray
+* NEARLY_SORTED: ascending, then parameter swaps of adjacent elements (size / 100 by default)
+* FEW_UNIQUE: parameter distinct values (10 by default) in random order
+* ORGAN_PIPE: ascending up to the middle, then descending
+* SAWTOOTH: ascending runs of parameter elements (size / 10 by default)
+* ZIPF: small values much more frequent, value k with probability ~ 1 / k^parameter (1 by default)
+* ALL_EQUAL: a single random value
+* RUNS: ascending runs of random length, parameter elements long on average (sqrt(size) by default)
+* GAUSSIAN: normal around the middle of the range, with a deviation of parameter times the
+*   range (1/6 by default), clamped to the range
+*/
+enum InputDistribution {
+	DIST_RANDOM = 0, DIST_ASCENDING, DIST_DESCENDING, DIST_NEARLY_SORTED, DIST_FEW_UNIQUE,
+	DIST_ORGAN_PIPE, DIST_SAWTOOTH, DIST_ZIPF, DIST_ALL_EQUAL, DIST_RUNS, DIST_GAUSSIAN, DIST_COUNT
+};
+
+inline const char *DistributionName(int distribution){
+	static const char *names[DIST_COUNT] = {
+		"random", "ascending", "descending", "nearly_sorted", "few_unique",
+		"organ_pipe", "sawtooth", "zipf", "all_equal", "runs", "gaussian"
+	};
+	return distribution >= 0 && distribution < DIST_COUNT? names[distribution]: NULL;
+}
+
+/**
+* returns the distribution with the given name, or -1 if there is none
+*/
+inline int DistributionByName(const char *name){
+	for(int distribution = 0; distribution < DIST_COUNT; ++distribution){
+		if(strcmp(name, DistributionName(distribution)) == 0){
+			return distribution;
+		}
+	}
+	return -1;
+}
+
+/**
+* maps u from [0, 1) to the range, the same way FillRandomArray spreads its values
+*/
+template <typename T>
+	T RangeValue(double u, T range_min, T range_max){
+		if(typeid(T) == typeid(double) || typeid(T) == typeid(float)){
+			return range_min + (T)u * (range_max - range_min);
+		}
+		unsigned long long range = (unsigned long long)((long long)range_max - (long long)range_min) + 1;
+		return (T)((long long)range_min + (long long)(std::min)((unsigned long long)(u * range), range - 1));
+	}
+
+/**
+* fills the given array with the given distribution, from the random stream of the
+* calling thread; parameter is described with InputDistribution, 0 picks its default
+*/
+template <typename T>
+	void FillDistribution(T *arr, size_t size, int distribution, T range_min=10, T range_max=50000, double parameter = 0){
+		RandomGenerator &rng = ThreadRandom();
+		size_t i, length;
+		switch(distribution){
+		case DIST_RANDOM:
+		case DIST_ASCENDING:
+		case DIST_DESCENDING:
+			FillRandomArray(arr, size, range_min, range_max, false, distribution);
+			break;
+		case DIST_NEARLY_SORTED:
+			FillRandomArray(arr, size, range_min, range_max, false, ASCENDING);
+			length = parameter > 0? (size_t)parameter: (std::max)((size_t)1, size / 100);
+			for(i = 0; i < length && size > 1; ++i){
+				size_t pos = (size_t)rng.below(size - 1);
+				std::swap(arr[pos], arr[pos + 1]);
+			}
+			break;
+		case DIST_FEW_UNIQUE:{
+			std::vector<T> values(parameter > 0? (size_t)parameter: 10);
+			for(size_t k = 0; k < values.size(); ++k){
+				values[k] = RangeValue(rng.uniform(), range_min, range_max);
+			}
+			for(i = 0; i < size; ++i){
+				arr[i] = values[(size_t)rng.below(values.size())];
+			}
+			break;
+		}
+		case DIST_ORGAN_PIPE:{
+			std::vector<T> sorted(size);
+			if(size > 0){
+				FillRandomArray(sorted.data(), size, range_min, range_max, false, ASCENDING);
+			}
+			//every other value goes up from the start, the rest down from the end
+			for(i = 0; i < size; ++i){
+				arr[i % 2 == 0? i / 2: size - 1 - i / 2] = sorted[i];
 			}
-			//we got a sorted array in ascending order
-			if(sorted == DESCENDING){
-				std::reverse(arr, arr+size);
-			}else if(sorted == UNSORTED){
-				//we need to scramble the array
-				for(i=0; i<size; ++i){
-					idx1 = rand() % size;
-					idx2 = rand() % size;
-					aux = arr[idx1];
-					arr[idx1] = arr[idx2];
-					arr[idx2] = aux;
+			break;
+		}
+		case DIST_SAWTOOTH:
+		case DIST_RUNS:{
+			size_t average = distribution == DIST_SAWTOOTH? (std::max)((size_t)1, size / 10): (std::max)((size_t)1, (size_t)sqrt((double)size));
+			if(parameter > 0){
+				average = (size_t)parameter;
+			}
+			for(i = 0; i < size; i += length){
+				length = distribution == DIST_SAWTOOTH? average: 1 + (size_t)rng.below(2ULL * average - 1);
+				length = (std::min)(length, size - i);
+				FillRandomArray(arr + i, length, range_min, range_max, false, ASCENDING);
+			}
+			break;
+		}
+		case DIST_ZIPF:{
+			//inverse transform over the cumulative weights of the first (at most 2^20) values
+			double exponent = parameter > 0? parameter: 1;
+			bool discreteType = typeid(T) != typeid(double) && typeid(T) != typeid(float);
+			unsigned long long range = discreteType? (unsigned long long)((long long)range_max - (long long)range_min) + 1: (std::max)((unsigned long long)1, (unsigned long long)size);
+			std::vector<double> cumulative((size_t)(std::min)(range, 1ULL << 20));
+			double total = 0;
+			for(size_t k = 0; k < cumulative.size(); ++k){
+				total += pow((double)(k + 1), -exponent);
+				cumulative[k] = total;
+			}
+			for(i = 0; i < size; ++i){
+				size_t k = std::upper_bound(cumulative.begin(), cumulative.end(), rng.uniform() * total) - cumulative.begin();
+				k = (std::min)(k, cumulative.size() - 1);
+				arr[i] = discreteType? (T)((long long)range_min + (long long)k): RangeValue((double)k / range, range_min, range_max);
+			}
+			break;
+		}
+		case DIST_ALL_EQUAL:{
+			T value = RangeValue(rng.uniform(), range_min, range_max);
+			for(i = 0; i < size; ++i){
+				arr[i] = value;
+			}
+			break;
+		}
+		case DIST_GAUSSIAN:{
+			double deviation = (parameter > 0? parameter: 1.0 / 6) * (double)(range_max - range_min);
+			double middle = ((double)range_min + (double)range_max) / 2;
+			for(i = 0; i < size; i += 2){
+				//Box-Muller, two normal values from two uniform ones
+				double radius = sqrt(-2 * log(1 - rng.uniform()));
+				double angle = 6.283185307179586 * rng.uniform();
+				double values[2] = { radius * cos(angle), radius * sin(angle) };
+				for(size_t k = 0; k < 2 && i + k < size; ++k){
+					double value = (std::max)((double)range_min, (std::min)((double)range_max, middle + deviation * values[k]));
+					arr[i + k] = (T)value;
 				}
 			}
+			break;
+		}
+		default:
+			throw "unknown distribution";
+		}
+	}
+
+/**
+* same as above, with the distribution given by name (see DistributionName)
+*/
+template <typename T>
+	void FillDistribution(T *arr, size_t size, const char *distribution, T range_min=10, T range_max=50000, double parameter = 0){
+		int id = DistributionByName(distribution);
+		if(id < 0){
+			throw "unknown distribution";
 		}
+		FillDistribution(arr, size, id, range_min, range_max, parameter);
 	}
 
 template <typename T>
-	void CopyArray(T *dst, T *src, int size) {
+	void CopyArray(T *dst, T *src, size_t size) {
 		memcpy(dst, src, size * sizeof(T));
 	}
 
 /**
-* Checks if the given array is sorted or not.
+* arrays shorter than this are verified by the calling thread alone
+*/
+const size_t PARALLEL_VERIFY_SIZE = 1 << 18;
+
+/**
+* calls f(from, to) on consecutive slices of [0, size), on one thread per core for
+* large arrays outside a parallel sweep, and returns true if every call did
+*/
+template <typename F>
+	bool ParallelSlices(size_t size, F f){
+		int threads = (int)(std::min)((size_t)std::thread::hardware_concurrency(), size / PARALLEL_VERIFY_SIZE);
+		if(threads <= 1 || InParallelSweep()){
+			return f(0, size);
+		}
+		std::vector<std::thread> workers;
+		std::vector<char> results(threads, 0);
+		for(int t = 0; t < threads; ++t){
+			size_t from = (size_t)((unsigned long long)size * t / threads);
+			size_t to = (size_t)((unsigned long long)size * (t + 1) / threads);
+			workers.push_back(std::thread([&f, &results, t, from, to](){ results[t] = f(from, to); }));
+		}
+		bool ok = true;
+		for(int t = 0; t < threads; ++t){
+			workers[t].join();
+			ok = ok && results[t];
+		}
+		return ok;
+	}
+
+/**
+* checks arr[i - 1] <= arr[i] for every i in [from, to), from being at least 1
 */
 template <typename T>
-	bool IsSorted(T *arr, int size){
-		int i;
-		for(i=1; i<size; ++i){
+	bool IsSortedSlice(const T *arr, size_t from, size_t to){
+		for(size_t i = from; i < to; ++i){
 			if(arr[i] < arr[i-1]){
 				return false;
 			}
@@ -11427,4 +15854,117 @@ template <typename T>
 		return true;
 	}
 
+/**
+* the same for int, comparing 16 neighbours at a time with SSE2
+*/
+inline bool IsSortedSlice(const int *arr, size_t from, size_t to){
+	size_t i = from;
+#ifdef PROFILER_HAS_SSE2
+	for(; i + 16 <= to; i += 16){
+		const __m128i *prev = (const __m128i*)(arr + i - 1);
+		const __m128i *crt = (const __m128i*)(arr + i);
+		__m128i descents = _mm_or_si128(
+			_mm_or_si128(_mm_cmpgt_epi32(_mm_loadu_si128(prev), _mm_loadu_si128(crt)),
+				_mm_cmpgt_epi32(_mm_loadu_si128(prev + 1), _mm_loadu_si128(crt + 1))),
+			_mm_or_si128(_mm_cmpgt_epi32(_mm_loadu_si128(prev + 2), _mm_loadu_si128(crt + 2)),
+				_mm_cmpgt_epi32(_mm_loadu_si128(prev + 3), _mm_loadu_si128(crt + 3))));
+		if(_mm_movemask_epi8(descents) != 0){
+			return false;
+		}
+	}
+#endif
+	for(; i < to; ++i){
+		if(arr[i] < arr[i-1]){
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+* Checks if the given array is sorted or not.
+*/
+template <typename T>
+	bool IsSorted(T *arr, size_t size){
+		return ParallelSlices(size, [arr](size_t from, size_t to){
+			return IsSortedSlice((const T*)arr, (std::max)(from, (size_t)1), to);
+		});
+	}
+
+/**
+* an order independent hash of the elements of an array: the sums of two different
+* 64 bit mixes of every element, so two arrays holding the same values in any order
+* have the same hash, and a lost, duplicated or changed element changes it
+*/
+struct MultisetHash{
+	unsigned long long first, second;
+
+	bool operator==(const MultisetHash &other) const { return first == other.first && second == other.second; }
+	bool operator!=(const MultisetHash &other) const { return !(*this == other); }
+};
+
+inline unsigned long long MixBits(unsigned long long x){
+	x ^= x >> 30;
+	x *= 0xbf58476d1ce4e5b9ULL;
+	x ^= x >> 27;
+	x *= 0x94d049bb133111ebULL;
+	x ^= x >> 31;
+	return x;
+}
+
+/**
+* works on the bytes of the elements, so T must not hold pointers or padding
+*/
+template <typename T>
+	MultisetHash HashMultiset(const T *arr, size_t size){
+		std::mutex lock;
+		MultisetHash hash = {0, 0};
+		ParallelSlices(size, [&](size_t from, size_t to){
+			MultisetHash slice = {0, 0};
+			for(size_t i = from; i < to; ++i){
+				unsigned long long word = 0x9e3779b97f4a7c15ULL;
+				const unsigned char *bytes = (const unsigned char*)&arr[i];
+				for(size_t offset = 0; offset < sizeof(T); offset += 8){
+					unsigned long long chunk = 0;
+					memcpy(&chunk, bytes + offset, (std::min)((size_t)8, sizeof(T) - offset));
+					word = MixBits(word ^ chunk);
+				}
+				slice.first += word;
+				slice.second += MixBits(word + 0x632be59bd9b4e019ULL);
+			}
+			std::lock_guard<std::mutex> guard(lock);
+			hash.first += slice.first;
+			hash.second += slice.second;
+			return true;
+		});
+		return hash;
+	}
+
+/**
+* checks the output of a sorting algorithm without sorting a copy of its input:
+*     verifier.expect(data, size);
+*     ... sort data ...
+*     assert(verifier.verify(data, size));
+* verify is true if the output is sorted and holds the same values as the input
+*/
+class SortVerifier{
+	MultisetHash expected;
+	size_t expectedSize;
+public:
+	SortVerifier() : expectedSize(0) {
+		expected.first = expected.second = 0;
+	}
+
+	template <typename T>
+	void expect(const T *input, size_t size){
+		expected = HashMultiset(input, size);
+		expectedSize = size;
+	}
+
+	template <typename T>
+	bool verify(const T *output, size_t size) const {
+		return size == expectedSize && IsSorted(output, size) && HashMultiset(output, size) == expected;
+	}
+};
+
 #endif
@@ -29,14 +29,14 @@
  *  Additionally, quadratic probing produces secondary clustering: if two keys have the same initial probe: h(k1,0) == h(k2,0), then their
  *      probe sequences are the same: h(k1,i) == h(k2, i). This also has an impact on performance.
  *
- * Results vs expected results. Comparison of the charts:
+ * Results vs expected results. Comparison of the effort grids of the report with the expected_effort ones, in the 10007 buckets column
+ *      (the effort counts are integers, so the averages are rounded down, and the expected ones rounded to the nearest):
  *  For load factor 0.8 and 0.85 the average efforts are really close to the expected ones.
  *  For load factor 0.9 there is a greater difference between the two values.
  *  For load factor 0.95 and 0.99, the average effort dramatically increases. It's much greater then the expected values.
  *  The maximum efforts are much greater the average ones for both successful and unsuccessful searches, and for all load factors.
  */
 #include <iostream>
-#include <fstream>
 #include <time.h>
 #include <cassert>
 #include <cstdlib>
@@ -285,114 +285,122 @@ void RandomPermutate(int a[], size_t size)
     }
 }
 
+/**
+ * Sweeps the bucket size together with the load factor, recording as grids of the report the
+ * average and the maximum effort of the successful and unsuccessful searches, next to the average
+ * effort uniform hashing is expected to take, and the average time of a search, measured on a
+ * pinned thread after warmup runs; the 10007 buckets column is the original evaluation
+ */
 void Evaluate()
 {
-    const size_t bucketSize = 10007;
+    //at least 3000 buckets, so that even half full they hold a distinct key for every successful search
+    const size_t bucketSizes[] = { 3001, 4001, 5003, 6007, 7001, 8009, 9001, 10007 };
+    const double loadFactors[] = { 0.5, 0.55, 0.6, 0.65, 0.7, 0.75, 0.8, 0.85, 0.9, 0.95, 0.99 };
     const unsigned int nrOfSearches = 3000;
+    const unsigned int nrOfFound = nrOfSearches / 2;
+    const unsigned int nrOfNotFound = (nrOfSearches + 1) / 2;
     const unsigned int nrOfMeasurements = 5;
     const int range_min = 0;
     const int range_max = 50000;
-    const double loadFactors[] = { 0.8, 0.85, 0.9, 0.95, 0.99 };
+    static int data[10007];
 
-    const int nrLoadFactors = sizeof(loadFactors) / sizeof(loadFactors[0]);
-    double effortAvgFound[nrLoadFactors] = {};
-    double effortAvgNotFound[nrLoadFactors] = {};
-    double effortMaxFound[nrLoadFactors] = {};
-    double effortMaxNotFound[nrLoadFactors] = {};
-    static int data[bucketSize];
+    Profiler profiler("Hash-Table-Sizing");
+    profiler.setNoiseControl();
 
     for (unsigned int m = 0; m < nrOfMeasurements; m++)
     {
-        for (int loadFactorIndex = 0; loadFactorIndex < nrLoadFactors; loadFactorIndex++)
+        for (size_t bucketSize : bucketSizes)
         {
-            HashTable<UniversalHash> ht(bucketSize);
-            int size = (int)(loadFactors[loadFactorIndex] * bucketSize);
-            int effort, totalEffort, maxEffort;
-
-            FillRandomArray(data, size, range_min, range_max, true, 0);
-
-            //Insert elements
-            for (int j = 0; j < size; j++)
-            {
-                ht.Insert(data[j], ("name" + to_string(data[j])).c_str());
-            }
-
-            //Check for correct insertion
-            if (size != ht.Size())
-            {
-                assert(size == ht.Size());
-            }
-            for (int j = 0; j < size; j++)
+            cout << "Evaluating bucket size " << bucketSize << " - measurement: " << m + 1 << "\n";
+            for (double loadFactor : loadFactors)
             {
-                const char* name = ht.Search(data[j], effort);
-                assert(name != nullptr);
-                assert(strcmp(name, ("name" + to_string(data[j])).c_str()) == 0);
+                HashTable<UniversalHash> ht(bucketSize);
+                int size = (int)(loadFactor * bucketSize);
+                int effort;
+                Operation found = profiler.createOperation(
+                    profiler.gridSeries("effort_found", loadFactor, "buckets", "load_factor"), bucketSize);
+                Operation notFound = profiler.createOperation(
+                    profiler.gridSeries("effort_not_found", loadFactor, "buckets", "load_factor"), bucketSize);
+                Timer timeFound = profiler.createTimer(
+                    profiler.gridSeries("time_found", loadFactor, "buckets", "load_factor"), bucketSize);
+                Timer timeNotFound = profiler.createTimer(
+                    profiler.gridSeries("time_not_found", loadFactor, "buckets", "load_factor"), bucketSize);
+
+                FillRandomArray(data, size, range_min, range_max, true, 0);
+
+                //Insert elements
+                for (int j = 0; j < size; j++)
+                {
+                    ht.Insert(data[j], ("name" + to_string(data[j])).c_str());
+                }
+
+                //Check for correct insertion
+                assert(size == (int)ht.Size());
+                for (int j = 0; j < size; j++)
+                {
+                    const char* name = ht.Search(data[j], effort);
+                    assert(name != nullptr);
+                    assert(strcmp(name, ("name" + to_string(data[j])).c_str()) == 0);
+                }
+
+                //Evaluate search effort and time, the searches do not change the table, so there
+                //is nothing to prepare between the runs
+                RandomPermutate(data, size);
+                profiler.benchmark(bucketSize, []() {}, [&]()
+                {
+                    int maxEffortFound = 0, maxEffortNotFound = 0;
+
+                    //Searching for existing elements
+                    timeFound.start();
+                    for (unsigned int j = 0; j < nrOfFound; j++)
+                    {
+                        const char* name = ht.Search(data[j], effort);
+                        assert(name != nullptr);
+                        assert(strcmp(name, ("name" + to_string(data[j])).c_str()) == 0);
+                        found.count(effort);
+                        maxEffortFound = max(effort, maxEffortFound);
+                    }
+                    timeFound.stop();
+
+                    //Searching for non-existing elements
+                    timeNotFound.start();
+                    for (unsigned int j = 1; j <= nrOfNotFound; j++)
+                    {
+                        const char* name = ht.Search(range_max + j, effort);
+                        assert(name == nullptr);
+                        notFound.count(effort);
+                        maxEffortNotFound = max(effort, maxEffortNotFound);
+                    }
+                    timeNotFound.stop();
+
+                    profiler.countOperation(profiler.gridSeries("max_effort_found", loadFactor, "buckets", "load_factor"),
+                        bucketSize, maxEffortFound);
+                    profiler.countOperation(profiler.gridSeries("max_effort_not_found", loadFactor, "buckets", "load_factor"),
+                        bucketSize, maxEffortNotFound);
+                });
             }
-
-            //Evaluate search time     
-            //Searching for existing elements
-            RandomPermutate(data, size);
-            totalEffort = 0;
-            maxEffort = -1;
-            for (int j = 0; j < nrOfSearches / 2; j++)
-            {
-                const char* name = ht.Search(data[j], effort);
-
-                totalEffort += effort;
-                maxEffort = max(effort, maxEffort);
-
-                assert(name != nullptr);
-                assert(strcmp(name, ("name" + to_string(data[j])).c_str()) == 0);
-            }
-            effortAvgFound[loadFactorIndex] += totalEffort / (nrOfSearches / 2);
-            effortMaxFound[loadFactorIndex] += maxEffort;
-
-            //Searching for non-existing elements
-            totalEffort = 0;
-            maxEffort = -1;
-            for (int j = 1; j <= (nrOfSearches + 1) / 2; j++)
-            {
-                const char* name = ht.Search(range_max + j, effort);
-                totalEffort += effort;
-                maxEffort = max(effort, maxEffort);
-                assert(name == nullptr);
-            }
-            effortAvgNotFound[loadFactorIndex] += totalEffort / ((nrOfSearches + 1) / 2);
-            effortMaxNotFound[loadFactorIndex] += maxEffort;
         }
     }
-    for (unsigned int i = 0; i < nrLoadFactors; i++)
+    profiler.divideGrid("effort_found", nrOfMeasurements * nrOfFound);
+    profiler.divideGrid("effort_not_found", nrOfMeasurements * nrOfNotFound);
+    profiler.divideGrid("time_found", nrOfMeasurements * nrOfFound);
+    profiler.divideGrid("time_not_found", nrOfMeasurements * nrOfNotFound);
+    profiler.divideGrid("max_effort_found", nrOfMeasurements);
+    profiler.divideGrid("max_effort_not_found", nrOfMeasurements);
+
+    //uniform hashing: 1/a * ln(1/(1-a)) probes for a successful search, 1/(1-a) for an unsuccessful one
+    for (size_t bucketSize : bucketSizes)
     {
-        effortAvgFound[i] /= nrOfMeasurements;
-        effortMaxFound[i] /= nrOfMeasurements;
-        effortAvgNotFound[i] /= nrOfMeasurements;
-        effortMaxNotFound[i] /= nrOfMeasurements;
+        for (double a : loadFactors)
+        {
+            profiler.countOperation(profiler.gridSeries("expected_effort_found", a, "buckets", "load_factor"),
+                bucketSize, (long long)(1 / a * log(1 / (1 - a)) + 0.5));
+            profiler.countOperation(profiler.gridSeries("expected_effort_not_found", a, "buckets", "load_factor"),
+                bucketSize, (long long)(1 / (1 - a) + 0.5));
+        }
     }
 
-    ofstream g("output.html");
-    g << "<!DOCTYPE html><html><head><style>table {  font-family: \"Trebuchet MS\", Arial, Helvetica, sans-serif;  border-collapse: collapse;  width: 100%;}table td, table th {  border: 1px solid #ddd;  padding: 8px;}table tr:nth-child(even){background-color: #f2f2f2;}table tr:hover {background-color: #ddd;}table th {  padding-top: 12px;  padding-bottom: 12px;  text-align: left;  background-color: #4CAF50;  color: white;}</style></head><body>";
-    g << "<h1>Results</h1>";
-    g << "<table><tr><th>Filling factor</th><th>Avg. Effort found</th><th>Max. Effort found</th><th>Avg. Effort not-found</th><th>Max. Effort not-found</th></tr>";
-    for (unsigned int i = 0; i < nrLoadFactors; i++)
-    {
-        g << "<tr><td>" << loadFactors[i] << "</td><td>"
-            << effortAvgFound[i] << "</td><td>"
-            << effortMaxFound[i] << "</td><td>"
-            << effortAvgNotFound[i] << "</td><td>"
-            << effortMaxNotFound[i] << "</td></tr>";
-    }
-    g << "</table>";
-    g << "<h1>Expected results for uniform hashing</h1>";
-    g << "<table><tr><th>Filling factor<br>a</th><th>Expected effort - found<br>1/a * ln(1/(1-a))</th><th>Expected effort - not-found<br>1/(1 - a)</th></tr>";
-    for (unsigned int i = 0; i < nrLoadFactors; i++)
-    {
-        g << "<tr><td>" << loadFactors[i] << "</td><td>"
-            << 1 / loadFactors[i] * log(1 / (1 - loadFactors[i])) << "</td><td>"
-            << 1 / (1 - loadFactors[i]) << "</td></tr>";
-    }
-    g << "</table></body></html>";
-    g.close();
-    system("output.html");
+    profiler.showReport();
 }
 
 int main()
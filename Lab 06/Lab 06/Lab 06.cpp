@@ -136,6 +136,7 @@ void OSTree::Print()
 
 OSTree::Node* OSTree::BuildPBTFromRange(int range_min, int range_max, Operation op)
 {
+    DepthGuard depthGuard(op);
     op.count();
     if (range_min <= range_max)
     {
@@ -182,6 +183,7 @@ OSTree::Node* OSTree::FindMin(Node* node, Operation op, bool decrement_size)
 
 OSTree::Node* OSTree::Select(OSTree::Node* root, int i, Operation op, bool decrement_size)
 {
+    DepthGuard depthGuard(op);
     op.count();
     if (root == nullptr)
         return nullptr;
@@ -298,12 +300,45 @@ void Demo()
     delete os;
 }
 
+/**
+ * Builds a tree of n nodes, then selects and deletes random ranks until it is empty, counting
+ * under the given names; the recursion depth of the build and of the selects is recorded along,
+ * with its histograms only if asked for, since they add up over every size of a sweep
+ */
+void MeasureOSTree(Profiler& profiler, int n, const string& build, const string& select, const string& del, bool histograms)
+{
+    Operation opBuild = profiler.createOperation(build.c_str(), n);
+    Operation opSelect = profiler.createOperation(select.c_str(), n);
+    Operation opDelete = profiler.createOperation(del.c_str(), n);
+
+    OSTree* os;
+    {
+        DepthScope depth(profiler, build.c_str(), n, histograms);
+        os = OSTree::Build(n, opBuild);
+    }
+
+    DepthScope depth(profiler, select.c_str(), n, histograms);
+    for (int i = 0; i < n; i++)
+    {
+        int index = rand() % os->Size() + 1;
+        os->Select(index, opSelect);
+        {
+            //Delete goes down through Select too, which is not a select of its own
+            DepthPause pause;
+            os->Delete(index, opDelete);
+        }
+    }
+    delete os;
+}
+
 void Evaluate()
 {
     const int range_min = 100;
     const int range_max = 10000;
     const int step_size = 100;
     const int nr_of_measurements = 5;
+    const int histogram_size = 5000;
+    const string histogram = "_" + to_string(histogram_size);
 
     Profiler profiler("Dynamic-Order-Statistics");
 
@@ -311,24 +346,23 @@ void Evaluate()
         for (int n = range_min; n <= range_max; n += step_size)
         {
             cout << "measurement: " << m << " size: " << n << "\n";
-            Operation opBuild = profiler.createOperation("BUILD_TREE", n);
-            Operation opSelect = profiler.createOperation("OS_SELECT", n);
-            Operation opDelete = profiler.createOperation("OS_DELETE", n);
-
-            OSTree* os = OSTree::Build(n, opBuild);
-
-            for (int i = 0; i < n; i++)
-            {
-                int index = rand() % os->Size() + 1;
-                os->Select(index, opSelect);
-                os->Delete(index, opDelete);
-            }
+            MeasureOSTree(profiler, n, "BUILD_TREE", "OS_SELECT", "OS_DELETE", false);
         }
+        MeasureOSTree(profiler, histogram_size, "BUILD_TREE" + histogram, "OS_SELECT" + histogram, "OS_DELETE" + histogram, true);
     }
     profiler.divideValues("BUILD_TREE", nr_of_measurements);
     profiler.divideValues("OS_SELECT", nr_of_measurements);
     profiler.divideValues("OS_DELETE", nr_of_measurements);
+    profiler.divideValues("BUILD_TREE_max_depth", nr_of_measurements);
+    profiler.divideValues("OS_SELECT_max_depth", nr_of_measurements);
+    for (const string& name : { "BUILD_TREE" + histogram, "OS_SELECT" + histogram })
+    {
+        profiler.divideValues((name + "_calls_at_depth").c_str(), nr_of_measurements);
+        profiler.divideValues((name + "_ops_at_depth").c_str(), nr_of_measurements);
+        profiler.divideValues((name + "_time_at_depth").c_str(), nr_of_measurements);
+    }
     profiler.createGroup("ALL_OPERATIONS", "BUILD_TREE", "OS_SELECT", "OS_DELETE");
+    profiler.createGroup("MAX_DEPTH", "BUILD_TREE_max_depth", "OS_SELECT_max_depth");
 
     profiler.addSeries("SELECT_AND_DELETE", "OS_SELECT", "OS_DELETE");
     profiler.addSeries("TOTAL", "SELECT_AND_DELETE", "BUILD_TREE");
@@ -33,6 +33,7 @@
 #include <set>
 #include <algorithm>
 #include <time.h>
+//#define PROFILER_TRACE
 #include "Profiler.h"
 
 using namespace std;
@@ -168,6 +169,9 @@ void Evaluate()
     profiler.createGroup("TOTAL_FOR_HALF_FIND_SET", "MAKE_SET", "HALF_FIND_SET", "UNION", "TOTAL_FOR_HALF_FIND_SET");
 
     profiler.showReport();
+#ifdef PROFILER_TRACE
+    ExportTrace("trace-DisjointSet_Kruskal.json");
+#endif // PROFILER_TRACE
 }
 
 int main()
@@ -284,13 +288,21 @@ void Graph::AddEdge(int x, int y, int w)
 
 Graph Graph::MSTKruskal(Operation opMake, Operation opFind, Operation opUnion)
 {
+    TRACE_SPAN("MSTKruskal");
     DisjointSet<int> ds;
     Graph mst;
-    for (const int& vertex : V)
     {
-        ds.MakeSet(vertex, opMake);
+        TRACE_SPAN("MSTKruskal/MakeSet");
+        for (const int& vertex : V)
+        {
+            ds.MakeSet(vertex, opMake);
+        }
+    }
+    {
+        TRACE_SPAN("MSTKruskal/SortEdges");
+        sort(E.begin(), E.end());
     }
-    sort(E.begin(), E.end());
+    TRACE_SPAN("MSTKruskal/FindUnion");
     for (const Edge& edge : E)
     {
         if (ds.FindSet(edge.x, opFind) != ds.FindSet(edge.y, opFind))
@@ -154,6 +154,7 @@ void Evaluate()
 
     srand(time(0));
     Profiler profiler("DFS");
+    profiler.setNoiseControl();
 
     for (int e = e_min; e <= e_max; e += e_steps)
     {
@@ -161,7 +162,13 @@ void Evaluate()
         Operation op = profiler.createOperation("v_fixed", e);
 
         Graph graph = GenerateGraph(v_fixed, e);
-        graph.DFS(&op);
+        profiler.benchmark(e, []() {}, [&]()
+        {
+            Timer timer = profiler.createTimer("time_v_fixed", e);
+            timer.start();
+            graph.DFS(&op);
+            timer.stop();
+        });
     }
 
     for (int v = v_min; v <= v_max; v += v_steps)
@@ -170,7 +177,13 @@ void Evaluate()
         Operation op = profiler.createOperation("e_fixed", v);
 
         Graph graph = GenerateGraph(v, e_fixed);
-        graph.DFS(&op);
+        profiler.benchmark(v, []() {}, [&]()
+        {
+            Timer timer = profiler.createTimer("time_e_fixed", v);
+            timer.start();
+            graph.DFS(&op);
+            timer.stop();
+        });
     }
 
     profiler.showReport();